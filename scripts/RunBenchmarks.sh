@@ -0,0 +1,60 @@
+#!/bin/bash
+
+# Builds and runs herald-bench, writing the results
+# to bench-results/<commit>.json so that they can be
+# compared with the results of another commit.
+#
+# Usage: scripts/RunBenchmarks.sh [baseline.json] [benchmark args...]
+#
+# If a baseline is given, the results are compared against
+# it with the compare.py tool of Google Benchmark, which is
+# looked up through BENCHMARK_COMPARE or the PATH.
+
+set -e
+
+root_dir="$(cd "$(dirname "$0")/.." && pwd)"
+
+build_dir="$root_dir/bench-build"
+
+results_dir="$root_dir/bench-results"
+
+baseline=""
+if [ "$1" != "" ] && [ -f "$1" ]; then
+  baseline="$1"
+  shift
+fi
+
+mkdir -p "$build_dir"
+
+# Benchmarks are meaningless without optimizations.
+(cd "$build_dir" && cmake "$root_dir/source/bench" -DCMAKE_BUILD_TYPE=Release -DHERALD_REQUIRE_BENCHMARK=ON)
+cmake --build "$build_dir" --target herald-bench
+
+mkdir -p "$results_dir"
+
+commit="$(git -C "$root_dir" rev-parse --short HEAD)"
+
+if ! git -C "$root_dir" diff --quiet HEAD -- source; then
+  commit="$commit-dirty"
+fi
+
+results="$results_dir/$commit.json"
+
+"$build_dir/herald-bench" \
+  --benchmark_out="$results" \
+  --benchmark_out_format=json \
+  "$@"
+
+echo "Results written to $results"
+
+if [ "$baseline" != "" ]; then
+
+  compare="${BENCHMARK_COMPARE:-$(command -v compare.py || true)}"
+
+  if [ "$compare" == "" ]; then
+    echo "compare.py was not found, set BENCHMARK_COMPARE to compare against $baseline"
+    exit 1
+  fi
+
+  "$compare" benchmarks "$baseline" "$results"
+fi
@@ -10,16 +10,27 @@
 #include "ProcessApi.h"
 #include "ResponseHandler.h"
 
+#include <herald/BundleLoader.h>
+#include <herald/BundleReader.h>
 #include <herald/Controller.h>
+#include <herald/FramePacer.h>
+#include <herald/LatencyTable.h>
+#include <herald/Model.h>
+#include <herald/OverlayStats.h>
+#include <herald/Profiler.h>
 #include <herald/QtEngine.h>
 #include <herald/QtTarget.h>
+#include <herald/TextureTable.h>
 
 #include <QDir>
 #include <QDirIterator>
+#include <QFile>
+#include <QElapsedTimer>
 #include <QGraphicsView>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QMessageBox>
+#include <QProgressDialog>
 #include <QStringList>
 #include <QTimer>
 #include <QWidget>
@@ -28,8 +39,31 @@ namespace {
 
 using namespace herald;
 
+/// Displays the progress of the textures
+/// that are being decoded while a game loads.
+class TextureProgress final : public TextureTable::Observer {
+  /// The dialog displaying the progress.
+  QProgressDialog dialog;
+public:
+  /// Constructs the texture progress dialog.
+  /// It's only shown if loading takes a while.
+  TextureProgress() : dialog("Loading textures...", QString(), 0, 0) {
+    dialog.setWindowModality(Qt::ApplicationModal);
+    dialog.setMinimumDuration(500);
+  }
+  /// Updates the progress of the dialog.
+  void texture_loaded(std::size_t loaded_count, std::size_t total_count) override {
+    dialog.setMaximum((int) total_count);
+    dialog.setValue((int) loaded_count);
+  }
+};
+
 /// Implements the active game interface.
 class ActiveGameImpl final : public ActiveGame, public Controller::Observer {
+  /// The game's bundle file, if it has one. The textures refer
+  /// to the mapped file, so this is declared before the engine
+  /// in order to be closed after it.
+  QFile bundle_file;
   /// The engine instance that's running the game.
   ScopedPtr<QtEngine> engine;
   /// The window that's displaying the game.
@@ -40,6 +74,10 @@ class ActiveGameImpl final : public ActiveGame, public Controller::Observer {
   Api* api;
   /// The timer for frame iteration.
   QTimer timer;
+  /// The monotonic clock that the frame times are measured with.
+  QElapsedTimer frame_clock;
+  /// Turns the measured frame times into simulation steps.
+  FramePacer pacer;
 public:
   /// Constructs an instance of the active game.
   /// @param parent A pointer to the parent object.
@@ -49,7 +87,10 @@ public:
       error_log(nullptr),
       api(nullptr) {
 
-    timer.setInterval(1000 / 30);
+    timer.setTimerType(Qt::PreciseTimer);
+    timer.setInterval((int) pacer.get_step_ms());
+
+    frame_clock.start();
 
     connect(&timer, &QTimer::timeout, this, &ActiveGameImpl::next_frame);
   }
@@ -63,12 +104,17 @@ public:
   bool open(const QString& path) override;
   /// Starts the scene animation.
   void start() override {
+    pacer.start((std::uint64_t) frame_clock.nsecsElapsed());
     timer.start();
   }
   /// Pauses the scene animation.
   void pause() override {
     timer.stop();
   }
+  /// Accesses the frame time statistics.
+  const FrameStats& get_frame_stats() const override {
+    return pacer.get_stats();
+  }
 protected:
   /// Updates axis values.
   void axis_update(double x, double y) override {
@@ -87,6 +133,14 @@ protected:
   /// The name of the model file is append to this directory path.
   /// @returns True on success, false on failure.
   bool open_model(const QString& game_path);
+  /// Maps the game's bundle file and loads the model from it.
+  /// The directory loader is used when this fails.
+  /// @param game_path The path to the game directory.
+  /// @returns True on success, false if there's no valid bundle.
+  bool open_bundle(const QString& game_path);
+  /// Records the last frame into the performance overlay,
+  /// and updates the rest of it if it's visible.
+  void update_overlay();
   /// Opens a message box and prints a message indicating why
   /// the game failed to open.
   /// @returns Always returns false.
@@ -118,6 +172,9 @@ bool ActiveGameImpl::open(const QString& path) {
 void ActiveGameImpl::close() {
 
   if (api) {
+    if (error_log) {
+      error_log->set_latency_table(nullptr);
+    }
     api->exit();
     delete api;
     api = nullptr;
@@ -141,6 +198,10 @@ bool ActiveGameImpl::open(const QString& path, const GameInfo& info) {
 
   engine = QtEngine::make(target.get());
 
+  pacer.set_frame_rate((std::size_t) info.get_frame_rate());
+
+  timer.setInterval((int) pacer.get_step_ms());
+
   api = info.make_api(path, engine->get_model(), this);
   if (!api) {
     return fail("Failed to create API instance");
@@ -151,6 +212,10 @@ bool ActiveGameImpl::open(const QString& path, const GameInfo& info) {
   connect(api, &Api::error_logged,   error_log, &ErrorLog::log);
   connect(api, &Api::error_occurred, error_log, &ErrorLog::log_fatal);
 
+  error_log->set_latency_table(api->get_latency_table());
+
+  engine->get_model()->get_texture_table()->set_memory_budget(info.get_texture_budget());
+
   open_model(path);
 
   graphics_view->show();
@@ -177,21 +242,107 @@ bool ActiveGameImpl::open_model(const QString& game_path) {
   ModelLoader::load(engine->get_model(), json_doc.object(), game_path);
 
 #else
-  if (!load_legacy_model(engine->get_model(), game_path)) {
+  if (!open_bundle(game_path) && !load_legacy_model(engine->get_model(), game_path)) {
     return false;
   }
+
+  // The room isn't built until the game answers "build_room",
+  // so the room's textures are prefetched by the room builder.
+  // Without a budget, every texture can be kept, so they're all
+  // decoded now, in parallel, behind the progress dialog.
+  auto* textures = engine->get_model()->get_texture_table();
+
+  if (!textures->get_cache_stats().memory_budget) {
+    engine->get_model()->prefetch_all_textures();
+  }
+
+  TextureProgress progress;
+
+  textures->finish_loading(&progress);
 #endif
 
   return true;
 }
 
+bool ActiveGameImpl::open_bundle(const QString& game_path) {
+
+  ProfileScope scope("ActiveGame::open_bundle");
+
+  bundle_file.setFileName(QDir(game_path).filePath("game.hbundle"));
+
+  if (!bundle_file.exists()) {
+    return false;
+  }
+
+  if (!bundle_file.open(QIODevice::ReadOnly)) {
+    error_log->warn_open_failure(bundle_file.fileName(), bundle_file.errorString());
+    return false;
+  }
+
+  auto* data = bundle_file.map(0, bundle_file.size());
+
+  BundleReader reader;
+
+  if (!data || !reader.open(data, (std::size_t) bundle_file.size())) {
+    error_log->log("Ignoring invalid bundle '" + bundle_file.fileName() + "'");
+    bundle_file.close();
+    return false;
+  }
+
+  return load_bundle_model(engine->get_model(), reader);
+}
+
 bool ActiveGameImpl::fail(const QString& message) {
   QMessageBox::critical(nullptr, "Game Creation Error", message);
   return false;
 }
 
 void ActiveGameImpl::next_frame() {
-  engine->advance((std::size_t) timer.interval());
+
+  ProfileScope scope("ActiveGame::next_frame");
+
+  if (api) {
+    api->flush_input();
+    api->check_stall();
+  }
+
+  auto steps = pacer.tick((std::uint64_t) frame_clock.nsecsElapsed());
+  if (steps > 0) {
+    engine->advance(steps * pacer.get_step_ms());
+  }
+
+  update_overlay();
+}
+
+void ActiveGameImpl::update_overlay() {
+
+  if (!target) {
+    return;
+  }
+
+  auto* overlay = target->get_overlay_stats();
+
+  overlay->record_frame(pacer.get_stats().get_last_ns());
+
+  if (!target->is_overlay_visible()) {
+    return;
+  }
+
+  if (api) {
+
+    overlay->set_queue_depth(api->get_pending_count());
+
+    const auto* latency_table = api->get_latency_table();
+    if (latency_table) {
+      overlay->set_last_rtt_ns(latency_table->get_last_ns());
+    }
+  }
+
+  auto cache_stats = engine->get_model()->get_texture_table()->get_cache_stats();
+
+  overlay->set_texture_memory(cache_stats.resident_bytes, cache_stats.memory_budget);
+
+  target->update_overlay();
 }
 
 } // namespace
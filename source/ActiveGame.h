@@ -2,6 +2,12 @@
 
 #include <QObject>
 
+namespace herald {
+
+class FrameStats;
+
+} // namespace herald
+
 /// This class represents a running game instance.
 class ActiveGame : public QObject {
   Q_OBJECT
@@ -23,6 +29,9 @@ public:
   virtual void start() = 0;
   /// Pauses the game.
   virtual void pause() = 0;
+  /// Accesses the statistics on the time
+  /// between the frames of the game.
+  virtual const herald::FrameStats& get_frame_stats() const = 0;
 signals:
   /// Emitted when the game is shutting down.
   void closing(ActiveGame* game);
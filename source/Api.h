@@ -2,10 +2,13 @@
 
 #include <QObject>
 
+#include <cstddef>
+
 namespace herald {
 
 enum class Button : int;
 
+class LatencyTable;
 class Model;
 
 } // namespace herald
@@ -29,6 +32,26 @@ public:
   virtual bool start() = 0;
   /// Exits the game.
   virtual void exit() = 0;
+  /// Sends the input updates that were gathered since
+  /// the last frame. This is called once per frame.
+  /// APIs that send input updates right away may
+  /// leave this as is.
+  virtual void flush_input() {}
+  /// Checks whether the game has stopped responding to
+  /// the commands sent to it. This is called once per frame.
+  /// APIs that don't wait on responses may leave this as is.
+  virtual void check_stall() {}
+  /// Indicates the number of commands that are
+  /// still waiting for a response from the game.
+  virtual std::size_t get_pending_count() const {
+    return 0;
+  }
+  /// Accesses the latencies of the commands sent to the game.
+  /// @returns The latency table, or null if the API doesn't
+  /// wait on responses.
+  virtual const herald::LatencyTable* get_latency_table() const {
+    return nullptr;
+  }
 public slots:
   /// Updates the axis for the default player.
   void update_def_axis(double x, double y) {
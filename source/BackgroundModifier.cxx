@@ -6,6 +6,7 @@
 
 #include "Interpreter.h"
 
+#include <herald/protocol/Binary.h>
 #include <herald/protocol/ParseTree.h>
 #include <herald/protocol/Parser.h>
 
@@ -41,6 +42,21 @@ public:
 
     model->get_background()->set_animation_index((std::size_t) animation_value);
 
+    return true;
+  }
+  /// Interprets the binary response, which
+  /// is the animation index as an int32 value.
+  /// @returns True on success, false on failure.
+  bool interpret_binary(protocol::BinaryReader& reader) override {
+
+    std::int32_t animation_value = 0;
+
+    if (!reader.read_i32(animation_value)) {
+      return false;
+    }
+
+    model->get_background()->set_animation_index((std::size_t) animation_value);
+
     return true;
   }
 };
@@ -1,8 +1,19 @@
 #include "ErrorLog.h"
 
+#include <herald/LatencyHistogram.h>
+#include <herald/LatencyTable.h>
+
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QSaveFile>
 #include <QTextEdit>
 #include <QVBoxLayout>
 
+#include <cstdint>
+#include <sstream>
+
 namespace {
 
 /// Enumerates the severity
@@ -35,21 +46,43 @@ QString format(Severity severity, const QString& message) {
   return header + message + "</b>";
 }
 
+/// Formats a latency in milliseconds.
+/// @param ns The latency to format, in nanoseconds.
+QString format_ms(std::uint64_t ns) {
+  return QString::number((double) ns / 1000000.0, 'f', 3);
+}
+
 } // namespace
 
-ErrorLog::ErrorLog(QWidget* parent) : QWidget(parent) {
+ErrorLog::ErrorLog(QWidget* parent) : QWidget(parent), latency_table(nullptr) {
 
   setWindowTitle("Error Log");
 
   text_edit = new QTextEdit(this);
   text_edit->setReadOnly(true);
 
+  QPushButton* show_latency_button = new QPushButton(tr("Show Latency"), this);
+  QPushButton* export_latency_button = new QPushButton(tr("Export Latency..."), this);
+
+  connect(show_latency_button, &QPushButton::clicked, this, &ErrorLog::show_latency);
+  connect(export_latency_button, &QPushButton::clicked, this, &ErrorLog::export_latency);
+
+  QHBoxLayout* button_layout = new QHBoxLayout();
+  button_layout->addStretch();
+  button_layout->addWidget(show_latency_button);
+  button_layout->addWidget(export_latency_button);
+
   QVBoxLayout* layout = new QVBoxLayout(this);
   layout->addWidget(text_edit);
+  layout->addLayout(button_layout);
 
   setLayout(layout);
 }
 
+void ErrorLog::set_latency_table(const herald::LatencyTable* table) {
+  latency_table = table;
+}
+
 void ErrorLog::log(const QString& line) {
 
   if (!line.isEmpty() && isHidden()) {
@@ -77,3 +110,63 @@ void ErrorLog::warn_open_failure(const QString& filename, const QString& error)
   message += ')';
   text_edit->textCursor().insertHtml(format(Severity::Warning, message));
 }
+
+void ErrorLog::show_latency() {
+
+  if (!latency_table || !latency_table->get_name_count()) {
+    text_edit->textCursor().insertText("No command latencies have been recorded.\n");
+    return;
+  }
+
+  QString html = "<table cellspacing=\"4\">"
+                 "<tr><th>command</th><th>count</th><th>p50 (ms)</th>"
+                 "<th>p99 (ms)</th><th>p999 (ms)</th><th>max (ms)</th></tr>";
+
+  for (std::size_t i = 0; i < latency_table->get_name_count(); i++) {
+
+    const auto& histogram = latency_table->get_histogram(i);
+
+    html += "<tr><td>";
+    html += QString(latency_table->get_name(i)).toHtmlEscaped();
+    html += "</td><td>" + QString::number(histogram.get_count());
+    html += "</td><td>" + format_ms(histogram.get_percentile(50.0));
+    html += "</td><td>" + format_ms(histogram.get_percentile(99.0));
+    html += "</td><td>" + format_ms(histogram.get_percentile(99.9));
+    html += "</td><td>" + format_ms(histogram.get_max_ns());
+    html += "</td></tr>";
+  }
+
+  html += "</table><br>";
+
+  text_edit->textCursor().insertHtml(html);
+}
+
+void ErrorLog::export_latency() {
+
+  if (!latency_table) {
+    QMessageBox::information(this, tr("Export Latency"), tr("This game doesn't measure command latency."));
+    return;
+  }
+
+  auto path = QFileDialog::getSaveFileName(this,
+                                           tr("Export Latency"),
+                                           "herald-latency.json",
+                                           tr("JSON Files (*.json)"));
+  if (path.isEmpty()) {
+    return;
+  }
+
+  std::ostringstream stream;
+
+  latency_table->write_json(stream);
+
+  auto json = stream.str();
+
+  QSaveFile file(path);
+
+  if (!file.open(QIODevice::WriteOnly)
+   || (file.write(json.data(), (qint64) json.size()) != (qint64) json.size())
+   || !file.commit()) {
+    QMessageBox::critical(this, tr("Export Latency"), tr("Failed to write the latency file."));
+  }
+}
@@ -2,16 +2,28 @@
 
 #include <QWidget>
 
+namespace herald {
+
+class LatencyTable;
+
+} // namespace herald
+
 class QTextEdit;
 
 /// The error log is for errors emitted
 /// from the game. It doesn't show up unless
-/// the game prints an error.
+/// the game prints an error. It can also show the
+/// latency of the commands sent to the game, which
+/// is usually what to look at when a game stalls.
 class ErrorLog : public QWidget {
 public:
   /// Constructs an error log instance.
   /// @param widget A pointer to the parent widget.
   ErrorLog(QWidget* parent);
+  /// Assigns the latencies that the log can show.
+  /// @param table The latency table of the game's API. This
+  /// may be null if the API doesn't measure latency.
+  void set_latency_table(const herald::LatencyTable* table);
 public slots:
   /// Logs a message into the error log.
   /// @param message The message to put onto the log.
@@ -24,7 +36,14 @@ public slots:
   /// @param error A string describing the reason the file couldn't open.
   /// This may be an empty string.
   void warn_open_failure(const QString& filename, const QString& error);
+  /// Puts a summary of the command latencies into the log.
+  void show_latency();
+  /// Asks for a file name and writes the
+  /// command latencies to it as JSON.
+  void export_latency();
 private:
   /// The text edit widget to put the messages into.
   QTextEdit* text_edit;
+  /// The latencies of the commands sent to the game.
+  const herald::LatencyTable* latency_table;
 };
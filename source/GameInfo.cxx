@@ -5,6 +5,8 @@
 #include "Api.h"
 #include "ProcessApi.h"
 
+#include <herald/protocol/Encoding.h>
+
 #include <QDir>
 #include <QFile>
 #include <QJsonArray>
@@ -125,6 +127,24 @@ public:
   QString get_title() const override {
     return root_object["title"].toString();
   }
+  /// Accesses the frame rate of the game.
+  int get_frame_rate() const override {
+    auto frame_rate = root_object["frame_rate"].toInt(30);
+    if ((frame_rate < 1) || (frame_rate > 1000)) {
+      return 30;
+    } else {
+      return frame_rate;
+    }
+  }
+  /// Gets the memory budget of the textures, in bytes.
+  std::size_t get_texture_budget() const override {
+    auto megabytes = root_object["texture_memory_mb"].toInt(0);
+    if (megabytes < 0) {
+      return 0;
+    } else {
+      return ((std::size_t) megabytes) * 1024 * 1024;
+    }
+  }
   /// Creates an API based off the game info.
   /// @param path The path to run the API from.
   /// @param m The model to be modified the the game API.
@@ -149,6 +169,9 @@ protected:
   /// @param parent A pointer to the parent object.
   /// @returns A new API instance on success, a null pointer on failure.
   Api* make_executable_api(const QString& path, Model* m, QObject* parent) const;
+  /// Applies the protocol options of the game to an API factory.
+  /// @param api_factory The API factory to apply the options to.
+  void apply_protocol_options(ProcessApiFactory& api_factory) const;
 };
 
 Api* GameInfoImpl::make_api(const QString& path, Model* m, QObject* parent) const {
@@ -182,6 +205,7 @@ Api* GameInfoImpl::make_java_api(const QString& path, Model* m, QObject* parent)
   api_factory->set_program(find_java());
   api_factory->set_working_directory(path);
   api_factory->set_args(QStringList(init_class));
+  apply_protocol_options(*api_factory);
   return api_factory->make_process_api(parent);
 }
 
@@ -190,6 +214,7 @@ Api* GameInfoImpl::make_python_api(const QString& path, Model* m, QObject* paren
   api_factory->set_model(m);
   api_factory->set_program(find_python());
   api_factory->set_working_directory(path);
+  apply_protocol_options(*api_factory);
   return api_factory->make_process_api(parent);
 }
 
@@ -212,9 +237,23 @@ Api* GameInfoImpl::make_executable_api(const QString& path, Model* m, QObject* p
   api_factory->set_model(m);
   api_factory->set_program(program);
   api_factory->set_working_directory(path);
+  apply_protocol_options(*api_factory);
   return api_factory->make_process_api(parent);
 }
 
+void GameInfoImpl::apply_protocol_options(ProcessApiFactory& api_factory) const {
+  auto protocol_name = root_object["protocol"].toString();
+
+  if (protocol_name.compare("binary", Qt::CaseInsensitive) == 0) {
+    api_factory.set_encoding(protocol::Encoding::Binary);
+  } else {
+    api_factory.set_encoding(protocol::Encoding::Text);
+  }
+
+  api_factory.set_batch_input(root_object["batch_input"].toBool());
+  api_factory.set_pipelined(root_object["pipelined"].toBool());
+}
+
 } // namespace
 
 GameInfo* GameInfo::open(const QString& game_path, QObject* parent) {
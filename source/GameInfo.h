@@ -2,6 +2,8 @@
 
 #include <QObject>
 
+#include <cstddef>
+
 class Api;
 class QString;
 
@@ -32,6 +34,15 @@ public:
   virtual QString get_error() const = 0;
   /// Gets the title of the game.
   virtual QString get_title() const = 0;
+  /// Gets the number of frames per second that the
+  /// game should run at. This comes from the "frame_rate"
+  /// field and is 30 when the field is missing or invalid.
+  virtual int get_frame_rate() const = 0;
+  /// Gets the number of bytes that decoded textures may
+  /// take. This comes from the "texture_memory_mb" field,
+  /// in megabytes, and is zero (no limit) when the field
+  /// is missing or invalid.
+  virtual std::size_t get_texture_budget() const = 0;
   /// Creates an API based on the game info.
   /// @param path The path to run the API from.
   /// @param model A pointer to the game model for the API to modify.
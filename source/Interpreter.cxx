@@ -2,6 +2,8 @@
 
 #include <herald/ScopedPtr.h>
 
+#include <herald/protocol/Arena.h>
+#include <herald/protocol/Binary.h>
 #include <herald/protocol/Lexer.h>
 #include <herald/protocol/ParseTree.h>
 #include <herald/protocol/Parser.h>
@@ -21,6 +23,9 @@ public:
   bool interpret(protocol::Parser&) override {
     return true;
   }
+  bool interpret_binary(protocol::BinaryReader&) override {
+    return true;
+  }
 };
 
 } // namespace
@@ -33,9 +38,17 @@ Interpreter* Interpreter::make_null(QObject* parent) {
 
 bool Interpreter::check(const herald::protocol::Node& node) {
 
-  auto errors = herald::protocol::SyntaxErrorList::make();
+  if (!arena) {
+    herald::protocol::Arena local_arena;
+    arena = &local_arena;
+    auto success = check(node);
+    arena = nullptr;
+    return success;
+  }
 
-  auto checker = make_syntax_checker(errors.get());
+  auto* errors = herald::protocol::SyntaxErrorList::make(*arena);
+
+  auto* checker = make_syntax_checker(errors, *arena);
 
   node.accept(*checker);
 
@@ -66,9 +79,34 @@ bool Interpreter::interpret_text(const QString& text) {
     }
   }
 
-  auto parser = herald::protocol::Parser::make(tokens.data(), tokens.size());
+  return interpret_tokens(tokens.data(), tokens.size());
+}
+
+bool Interpreter::interpret_tokens(const herald::protocol::Token* tokens, std::size_t count) {
+
+  herald::protocol::Arena local_arena;
+
+  return interpret_tokens(tokens, count, local_arena);
+}
+
+bool Interpreter::interpret_tokens(const herald::protocol::Token* tokens,
+                                   std::size_t count,
+                                   herald::protocol::Arena& a) {
+
+  auto* parser = herald::protocol::Parser::make(tokens, count, a);
+
+  arena = &a;
 
   auto success = interpret(*parser);
 
+  arena = nullptr;
+
   return success;
 }
+
+bool Interpreter::interpret_frame(const unsigned char* payload, std::size_t size) {
+
+  herald::protocol::BinaryReader reader(payload, size);
+
+  return interpret_binary(reader);
+}
@@ -2,15 +2,20 @@
 
 #include <QObject>
 
+#include <cstddef>
+
 class QString;
 
 namespace herald {
 
 namespace protocol {
 
+class Arena;
+class BinaryReader;
 class Node;
 class Parser;
 class SyntaxError;
+class Token;
 
 } // namespace protocol
 
@@ -28,13 +33,36 @@ public:
   static Interpreter* make_null(QObject* parent);
   /// Constructs the base interpreter instance.
   /// @param parent A pointer to the parent object.
-  Interpreter(QObject* parent) : QObject(parent) {}
+  Interpreter(QObject* parent) : QObject(parent), arena(nullptr) {}
   /// Just a stub.
   virtual ~Interpreter() {}
   /// Tokenizes the line of text and relays
   /// the parser to a derived class.
   /// @param text The text from the response.
   bool interpret_text(const QString& text);
+  /// Relays the tokens of a response line
+  /// to the parser of a derived class.
+  /// @param tokens The significant tokens of the response.
+  /// @param count The number of tokens in the response.
+  /// @returns True on success, false on failure.
+  bool interpret_tokens(const herald::protocol::Token* tokens, std::size_t count);
+  /// Relays the tokens of a response line to the parser
+  /// of a derived class. The parse tree and any syntax
+  /// errors are allocated from an arena, which the caller
+  /// may reset once the response has been interpreted.
+  /// @param tokens The significant tokens of the response.
+  /// @param count The number of tokens in the response.
+  /// @param arena The arena to allocate from.
+  /// @returns True on success, false on failure.
+  bool interpret_tokens(const herald::protocol::Token* tokens,
+                        std::size_t count,
+                        herald::protocol::Arena& arena);
+  /// Relays the payload of a binary response
+  /// frame to the decoder of a derived class.
+  /// @param payload The payload of the frame.
+  /// @param size The number of bytes in the payload.
+  /// @returns True on success, false if the payload is malformed.
+  bool interpret_frame(const unsigned char* payload, std::size_t size);
 signals:
   /// This signal is emitted when a syntax
   /// error is detected by the parser.
@@ -49,4 +77,12 @@ protected:
   /// @param parser A parser instance to parse the response with.
   /// @returns True on success, false on failure.
   virtual bool interpret(herald::protocol::Parser& parser) = 0;
+  /// Interprets a response of the binary protocol.
+  /// @param reader A reader for the payload of the response frame.
+  /// @returns True on success, false on failure.
+  virtual bool interpret_binary(herald::protocol::BinaryReader& reader) = 0;
+private:
+  /// The arena of the response being interpreted.
+  /// This is null outside of @ref interpret_tokens.
+  herald::protocol::Arena* arena;
 };
@@ -7,9 +7,11 @@
 #include <herald/Engine.h>
 #include <herald/Index.h>
 #include <herald/Model.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
 #include <herald/TextureTable.h>
 
+#include <QCryptographicHash>
 #include <QDir>
 #include <QDirIterator>
 #include <QFile>
@@ -17,6 +19,8 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 
+#include <map>
+
 namespace herald {
 
 namespace {
@@ -27,6 +31,9 @@ class LegacyModelLoader final {
   QDir root;
   /// The model to put the data into.
   Model* model;
+  /// The index of each texture that was opened,
+  /// keyed by the hash of the texture's file content.
+  std::map<QByteArray, std::size_t> texture_indices;
 public:
   /// Constructs the legacy model loader.
   /// @param m The model to put the data into.
@@ -51,6 +58,8 @@ protected:
   /// @returns True on success, false on failure.
   bool load_actions() {
 
+    ProfileScope scope("LegacyModelLoader::load_actions");
+
     QFile actions_file(root.filePath("actions.json"));
 
     if (!actions_file.open(QIODevice::ReadOnly | QIODevice::Text)) {
@@ -76,12 +85,12 @@ protected:
   /// @returns True on success, false on failure.
   bool load_textures() {
 
+    ProfileScope scope("LegacyModelLoader::load_textures");
+
     QDir::Filters filters = QDir::NoDotAndDotDot | QDir::NoSymLinks | QDir::Files | QDir::Dirs;
 
     auto texture_list = get_sorted_dir_entries(root.filePath("textures"), filters);
 
-    auto* texture_table = model->get_texture_table();
-
     auto* animation_table = model->get_animation_table();
 
     for (auto texture : texture_list) {
@@ -91,10 +100,7 @@ protected:
       if (texture_info.isDir()) {
         load_animation_dir(texture);
       } else {
-        // Ensure these two functions
-        // are kept in this order.
-        animation_table->add_still_frame(texture_table->size());
-        texture_table->open(texture.toStdString().c_str());
+        animation_table->add_still_frame(open_texture(texture));
       }
     }
 
@@ -105,12 +111,8 @@ protected:
   /// @returns True on success, false on failure.
   bool load_animation_dir(const QString& path) {
 
-    auto* texture_table = model->get_texture_table();
-
     auto* animation_table = model->get_animation_table();
 
-    auto texture_offset = texture_table->size();
-
     // Default 30fps
     std::size_t delay = 1000 / 30;
 
@@ -122,15 +124,49 @@ protected:
 
     for (auto texture_path : textures) {
 
-      animation->add_frame(texture_offset++, delay);
-
-      texture_table->open(texture_path.toStdString().c_str());
+      animation->add_frame(open_texture(texture_path), delay);
     }
 
     animation_table->add(std::move(animation));
 
     return true;
   }
+  /// Opens a texture, unless a texture with the same file
+  /// content was opened already. Asset packs often repeat frames,
+  /// so this keeps each distinct image down to one table entry.
+  /// @param path The path to the texture file.
+  /// @returns The index of the texture in the texture table.
+  std::size_t open_texture(const QString& path) {
+
+    QByteArray key;
+
+    QFile file(path);
+
+    if (file.open(QIODevice::ReadOnly)) {
+      QCryptographicHash hash(QCryptographicHash::Sha1);
+      hash.addData(&file);
+      key = hash.result();
+    }
+
+    if (!key.isEmpty()) {
+      auto it = texture_indices.find(key);
+      if (it != texture_indices.end()) {
+        return it->second;
+      }
+    }
+
+    auto* texture_table = model->get_texture_table();
+
+    auto index = texture_table->size();
+
+    texture_table->open(path.toStdString().c_str());
+
+    if (!key.isEmpty()) {
+      texture_indices.emplace(key, index);
+    }
+
+    return index;
+  }
   /// Accumulates the paths of a directory
   /// and sorts them into a string list.
   /// @param path The path to get the entries of.
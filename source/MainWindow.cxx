@@ -7,8 +7,15 @@
 #include "Config.h"
 #endif
 
+#include <herald/Profiler.h>
+
 #include <QAction>
 #include <QFileDialog>
+#include <QMenuBar>
+#include <QMessageBox>
+#include <QSaveFile>
+
+#include <sstream>
 
 MainWindow::MainWindow() {
 
@@ -26,6 +33,15 @@ MainWindow::MainWindow() {
 
   setWindowTitle(title);
 
+  file_menu = menuBar()->addMenu(tr("&File"));
+
+  open_action = file_menu->addAction(tr("&Open Game..."));
+
+  export_trace_action = file_menu->addAction(tr("&Export Frame Trace..."));
+
+  connect(open_action,         &QAction::triggered, this, &MainWindow::open_from_dialog);
+  connect(export_trace_action, &QAction::triggered, this, &MainWindow::export_frame_trace);
+
   connect(central_widget, &CentralWidget::delete_requested,   this, &MainWindow::delete_requested);
   connect(central_widget, &CentralWidget::game_selected,      this, &MainWindow::game_selected);
   connect(central_widget, &CentralWidget::open_requested,     this, &MainWindow::open_from_dialog);
@@ -47,6 +63,39 @@ void MainWindow::open_from_dialog() {
   emit open_requested(path);
 }
 
+void MainWindow::export_frame_trace() {
+
+  if (!herald::Profiler::get_event_count()) {
+    QMessageBox::information(this,
+                             tr("Export Frame Trace"),
+                             tr("No frames have been profiled. Turn on \"Profile Frames\" "
+                                "in the settings, or set HERALD_PROFILE=1, then play a game."));
+    return;
+  }
+
+  auto path = QFileDialog::getSaveFileName(this,
+                                           tr("Export Frame Trace"),
+                                           "herald-trace.json",
+                                           tr("Trace Files (*.json)"));
+  if (path.isEmpty()) {
+    return;
+  }
+
+  std::ostringstream stream;
+
+  herald::Profiler::write_chrome_trace(stream);
+
+  auto trace = stream.str();
+
+  QSaveFile file(path);
+
+  if (!file.open(QIODevice::WriteOnly)
+   || (file.write(trace.data(), (qint64) trace.size()) != (qint64) trace.size())
+   || !file.commit()) {
+    QMessageBox::critical(this, tr("Export Frame Trace"), tr("Failed to write the trace file."));
+  }
+}
+
 void MainWindow::open_settings_dialog() {
   settings_dialog->show();
 }
@@ -37,6 +37,9 @@ protected slots:
   void open_from_dialog();
   /// Opens up the settings dialog.
   void open_settings_dialog();
+  /// Writes the profiled frames to a trace file,
+  /// which can be opened with chrome://tracing or Perfetto.
+  void export_frame_trace();
 protected:
   /// Overrides the close event for the main window.
   /// This is so that the engine can be notified that
@@ -54,4 +57,6 @@ private:
   QMenu* file_menu;
   /// Opens a new game.
   QAction* open_action;
+  /// Exports the profiled frames.
+  QAction* export_trace_action;
 };
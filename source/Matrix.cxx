@@ -81,18 +81,12 @@ ScopedPtr<Matrix> Matrix::make(const protocol::Matrix& m) {
 
   auto matrix = Matrix::make(w, h);
 
-  for (std::size_t y = 0; y < h; y++) {
+  const auto* values = m.get_values();
 
-    for (std::size_t x = 0; x < w; x++) {
+  auto count = m.get_value_count();
 
-      auto v_node = m.get_integer((y * w) + x);
-
-      int v = 0;
-
-      if (v_node.to_signed_value(v)) {
-        matrix->set(x, y, v);
-      }
-    }
+  for (std::size_t i = 0; (i < count) && (i < (w * h)); i++) {
+    matrix->set(i % w, i / w, values[i]);
   }
 
   return matrix;
@@ -23,6 +23,11 @@ public:
   bool interpret(protocol::Parser&) override {
     return true;
   }
+  /// Interpreters the binary response to the command.
+  /// @returns True on success, false on failure.
+  bool interpret_binary(protocol::BinaryReader&) override {
+    return true;
+  }
 };
 
 } // namespace
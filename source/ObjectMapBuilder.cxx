@@ -1,13 +1,14 @@
 #include "ObjectMapBuilder.h"
 
+#include <herald/Index.h>
 #include <herald/Model.h>
-#include <herald/Object.h>
 #include <herald/ObjectTable.h>
 #include <herald/ScopedPtr.h>
 #include <herald/Vec2f.h>
 
 #include "Interpreter.h"
 
+#include <herald/protocol/Binary.h>
 #include <herald/protocol/ParseTree.h>
 #include <herald/protocol/Parser.h>
 
@@ -50,19 +51,50 @@ public:
 
     for (std::size_t i = 0; i < count; i++) {
 
-      auto* object = object_table->at(i);
-
-      if (!parse_object(parser, object)) {
+      if (!parse_object(parser, *object_table, i)) {
         break;
       }
     }
 
+    return true;
+  }
+  /// Interprets the binary response, which is the number
+  /// of objects as a uint32 value followed by the X, Y
+  /// and action of each object as int32 values.
+  /// @param reader The reader of the response payload.
+  /// @returns True on success, false on failure.
+  bool interpret_binary(protocol::BinaryReader& reader) override {
+
+    std::uint32_t count = 0;
+
+    if (!reader.read_u32(count)) {
+      return false;
+    } else if ((reader.remaining() / 12) < count) {
+      return false;
+    }
+
+    auto* object_table = model->get_object_table();
+
+    object_table->resize(count);
+
+    for (std::size_t i = 0; i < count; i++) {
+
+      std::int32_t values[3] { 0, 0, 0 };
+
+      reader.read_i32_array(values, 3);
+
+      object_table->translate(i, Vec2f(values[0], values[1]));
+      object_table->set_action_index(i, (std::size_t) values[2]);
+    }
+
     return true;
   }
 protected:
   /// Parses a single object.
   /// @param parser The parser to parse the object with.
-  bool parse_object(protocol::Parser& parser, Object* object) {
+  /// @param object_table The table containing the object.
+  /// @param index The index of the object to assign.
+  bool parse_object(protocol::Parser& parser, ObjectTable& object_table, std::size_t index) {
 
     auto x_node = parser.parse_integer();
     auto y_node = parser.parse_integer();
@@ -84,8 +116,8 @@ protected:
       return false;
     }
 
-    object->translate(Vec2f(x, y));
-    object->set_action_index((std::size_t) action);
+    object_table.translate(index, Vec2f(x, y));
+    object_table.set_action_index(index, (std::size_t) action);
 
     return true;
   }
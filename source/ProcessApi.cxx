@@ -1,6 +1,8 @@
 #include "ProcessApi.h"
 
 #include <herald/Controller.h>
+#include <herald/LatencyTable.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
 
 #include "Api.h"
@@ -12,19 +14,54 @@
 #include "ResponseHandler.h"
 #include "RoomBuilder.h"
 #include "WorkQueue.h"
-#include "Writer.h"
 
+#include <herald/protocol/Arena.h>
+#include <herald/protocol/Binary.h>
 #include <herald/protocol/Command.h>
+#include <herald/protocol/Encoding.h>
+#include <herald/protocol/InputBatch.h>
+#include <herald/protocol/Lexer.h>
+#include <herald/protocol/ParseTree.h>
 #include <herald/protocol/SyntaxChecker.h>
+#include <herald/protocol/Token.h>
 
 #include <QProcess>
 #include <QString>
 #include <QStringList>
 
+#include <cstdint>
+
 namespace herald {
 
 namespace {
 
+/// How long the oldest command may wait for its
+/// response before the game is reported as stalled.
+const std::uint64_t stall_threshold_ns = 2000000000;
+
+/// Parses the header of a tagged response.
+/// The header has the form "seq <id> <line_count>"
+/// and is followed by the lines of the response.
+/// @param tokens The significant tokens of the line.
+/// @param count The number of tokens in the line.
+/// @param id Receives the sequence ID of the response.
+/// @param line_count Receives the number of lines that follow.
+/// @returns True if the line is a response header, false otherwise.
+bool parse_sequence_header(const protocol::Token* tokens,
+                           std::size_t count,
+                           unsigned int& id,
+                           unsigned int& line_count) {
+
+  if ((count != 3)
+   || !tokens[0].has_type(protocol::TokenType::Identifier)
+   || !tokens[0].has_data("seq")) {
+    return false;
+  }
+
+  return protocol::Integer(nullptr, &tokens[1]).to_unsigned_value(id)
+      && protocol::Integer(nullptr, &tokens[2]).to_unsigned_value(line_count);
+}
+
 /// An implementation of an API
 /// using an external process and redirected IO.
 class ProcessApi final : public Api {
@@ -32,12 +69,46 @@ class ProcessApi final : public Api {
   QProcess process;
   /// The model to be modified.
   Model* model;
-  /// The line buffer for the standard output.
-  LineBuffer* out_line_buffer;
+  /// Scans the standard output of the process,
+  /// straight from the bytes that are read.
+  ScopedPtr<protocol::StreamLexer> out_lexer;
+  /// Splits the standard output of the process
+  /// into frames, when the binary encoding is used.
+  ScopedPtr<protocol::FrameDecoder> out_decoder;
+  /// The arena that the parse tree of each response
+  /// is allocated from. It's reset after every response,
+  /// so it only allocates until it reaches its working size.
+  protocol::Arena response_arena;
+  /// The encoding of the commands and responses.
+  protocol::Encoding encoding;
   /// The line buffer for standard error output.
   LineBuffer* err_line_buffer;
   /// The queue of work items.
   ScopedPtr<WorkQueue> work_queue;
+  /// The input updates gathered since the last frame.
+  ScopedPtr<protocol::InputBatch> input_batch;
+  /// Whether or not input updates are gathered
+  /// into one command per frame.
+  bool batch_input;
+  /// Whether or not commands are tagged with sequence IDs,
+  /// so that they don't have to wait on each other.
+  bool pipelined;
+  /// The sequence ID to assign to the next command.
+  unsigned int next_sequence_id;
+  /// The sequence ID of the tagged response being read.
+  unsigned int response_id;
+  /// The number of lines remaining in
+  /// the tagged response being read.
+  unsigned int response_lines;
+  /// When the output being handled was read from the
+  /// process. This is the receive time of its responses.
+  std::uint64_t received_ns;
+  /// The send time of the last command that was reported
+  /// as stalled, so that each stall is only reported once.
+  std::uint64_t stalled_send_ns;
+  /// Whether or not the framing error of the binary
+  /// stream was reported, so that it's only reported once.
+  bool framing_error_reported;
   /// Whether or not the command to exit
   /// the game was requested.
   bool exit_requested;
@@ -48,18 +119,30 @@ public:
   ProcessApi(Model* model_, QObject* parent)
     : Api(parent),
       model(model_),
-      out_line_buffer(nullptr),
+      out_lexer(protocol::StreamLexer::make()),
+      out_decoder(protocol::FrameDecoder::make()),
+      encoding(protocol::Encoding::Text),
       err_line_buffer(nullptr),
-      work_queue(nullptr) {
+      work_queue(nullptr),
+      input_batch(protocol::InputBatch::make()),
+      batch_input(false),
+      pipelined(false),
+      next_sequence_id(0),
+      response_id(0),
+      response_lines(0),
+      received_ns(0),
+      stalled_send_ns(0),
+      framing_error_reported(false) {
 
     exit_requested = false;
 
     work_queue = WorkQueue::make();
 
-    out_line_buffer = LineBuffer::from_process_stdout(process, this);
     err_line_buffer = LineBuffer::from_process_stderr(process, this);
 
-    connect(out_line_buffer, &LineBuffer::line, this, &ProcessApi::handle_line);
+    process.setReadChannel(QProcess::StandardOutput);
+
+    connect(&process, &QProcess::readyReadStandardOutput, this, &ProcessApi::read_output);
     connect(err_line_buffer, &LineBuffer::line, this, &Api::error_logged);
 
     connect(&process, &QProcess::errorOccurred, this, &ProcessApi::handle_process_error);
@@ -73,7 +156,9 @@ public:
 
     exit_requested = true;
 
-    process.write(Writer::exit());
+    auto exit_command = protocol::Command::make_nullary("exit", encoding);
+
+    send_command(*exit_command);
 
     const int timeout_ms = 5000;
 
@@ -86,11 +171,29 @@ public:
   /// @param model The model to add the game data into.
   /// @returns True on success, false on failure.
   bool start() override {
-    add_work_item(protocol::Command::make_nullary("set_background"), make_background_modifier(model, this));
-    add_work_item(protocol::Command::make_nullary("build_room"), make_room_builder(model, this));
-    add_work_item(protocol::Command::make_nullary("build_object_map"), make_object_table_builder(model, this));
+    add_work_item(protocol::Command::make_nullary("set_background", encoding), make_background_modifier(model, this));
+    add_work_item(protocol::Command::make_nullary("build_room", encoding), make_room_builder(model, this));
+    add_work_item(protocol::Command::make_nullary("build_object_map", encoding), make_object_table_builder(model, this));
     return true;
   }
+  /// Assigns the encoding of the commands and responses.
+  /// This should only be called before the process is started.
+  /// @param e The encoding to assign.
+  void set_encoding(protocol::Encoding e) noexcept {
+    encoding = e;
+  }
+  /// Enables or disables gathering input updates.
+  /// This should only be called before the process is started.
+  /// @param on Whether or not to enable input batching.
+  void set_batch_input(bool on) noexcept {
+    batch_input = on;
+  }
+  /// Enables or disables tagging commands with sequence IDs.
+  /// This should only be called before the process is started.
+  /// @param on Whether or not to enable pipelining.
+  void set_pipelined(bool on) noexcept {
+    pipelined = on;
+  }
   /// This should only be called before the process is started.
   /// @param pwd The path to place the process into.
   void set_working_directory(const QString& pwd) {
@@ -109,14 +212,68 @@ public:
   /// @param x The X value of the axis.
   /// @param y The Y value of the axis.
   void update_axis(int controller, double x, double y) override {
-    add_work_item(protocol::Command::make_axis_update(controller, x, y), make_response_handler(model, this));
+    if (batch_input) {
+      input_batch->update_axis(controller, x, y);
+      return;
+    }
+    add_work_item(protocol::Command::make_axis_update(controller, x, y, encoding), make_response_handler(model, this));
   }
   /// Notifies the process of a change in button state.
   /// @param controller The index of the controller.
   /// @param button The button that changed state.
   /// @param state The new state of the button.
   void update_button(int controller, Button button, bool state) override {
-    add_work_item(protocol::Command::make_button_update(controller, button_id(button), state), make_response_handler(model, this));
+    if (batch_input) {
+      input_batch->update_button(controller, button_id(button), state);
+      return;
+    }
+    add_work_item(protocol::Command::make_button_update(controller, button_id(button), state, encoding), make_response_handler(model, this));
+  }
+  /// Sends the input updates of the last frame,
+  /// if there were any, as one command.
+  void flush_input() override {
+
+    if (input_batch->empty()) {
+      return;
+    }
+
+    add_work_item(protocol::Command::make_batch_update(*input_batch, encoding), make_response_handler(model, this));
+
+    input_batch->clear();
+  }
+  /// Reports the game as stalled when the oldest command
+  /// has waited on its response for too long.
+  void check_stall() override {
+
+    if (work_queue->empty()) {
+      return;
+    }
+
+    auto sent_ns = work_queue->get_current_send_time();
+
+    auto waited_ns = Profiler::now_ns() - sent_ns;
+
+    if ((waited_ns < stall_threshold_ns) || (sent_ns == stalled_send_ns)) {
+      return;
+    }
+
+    stalled_send_ns = sent_ns;
+
+    emit error_logged(QString("Game stalled: no response to '")
+                    + QString(work_queue->get_current_command().get_name())
+                    + QString("' after ")
+                    + QString::number(waited_ns / 1000000)
+                    + QString(" ms (")
+                    + QString::number(work_queue->size())
+                    + QString(" commands waiting).\n"));
+  }
+  /// Indicates the number of commands waiting for a response.
+  std::size_t get_pending_count() const override {
+    return work_queue->size();
+  }
+  /// Accesses the latencies of the commands.
+  const LatencyTable* get_latency_table() const override {
+    return &work_queue->get_latency_table();
   }
 protected slots:
   /// Handles the finishing signal emitted from the process.
@@ -131,18 +288,152 @@ protected slots:
                         + QString(")"));
     }
   }
+  /// Reads the available data from the standard output
+  /// of the process directly into the lexer buffer, and
+  /// then handles each line that was completed by it.
+  void read_output() {
+
+    auto available = process.bytesAvailable();
+    if (available <= 0) {
+      return;
+    }
+
+    received_ns = Profiler::now_ns();
+
+    if (encoding == protocol::Encoding::Binary) {
+      read_frames(available);
+      return;
+    }
+
+    auto* data = out_lexer->reserve((std::size_t) available);
+
+    auto read_count = process.read(data, available);
+
+    out_lexer->commit((read_count > 0) ? ((std::size_t) read_count) : 0);
+
+    for (;;) {
+      if (response_lines > 0) {
+        if (!out_lexer->append_line()) {
+          break;
+        } else if (--response_lines == 0) {
+          handle_tagged_response();
+        }
+      } else if (out_lexer->next_line()) {
+        handle_line(out_lexer->get_tokens(), out_lexer->get_token_count());
+      } else {
+        break;
+      }
+    }
+  }
+  /// Reads the available data from the standard output
+  /// of the process into the frame decoder, and then
+  /// handles each frame that was completed by it.
+  /// @param available The number of bytes available.
+  void read_frames(qint64 available) {
+
+    auto* data = out_decoder->reserve((std::size_t) available);
+
+    auto read_count = process.read(data, available);
+
+    out_decoder->commit((read_count > 0) ? ((std::size_t) read_count) : 0);
+
+    while (out_decoder->next_frame()) {
+      handle_frame();
+    }
+
+    if (out_decoder->has_error() && !framing_error_reported) {
+      framing_error_reported = true;
+      emit error_occurred(QString(out_decoder->get_error_description()));
+    }
+  }
+  /// Handles a binary response frame. If the frame is tagged,
+  /// it goes to the command with the matching sequence ID.
+  /// Otherwise, it goes to the oldest command.
+  void handle_frame() {
+
+    ProfileScope scope("ProcessApi::handle_frame");
+
+    auto sequence_id = out_decoder->get_sequence_id();
+
+    auto tagged = (sequence_id != protocol::untagged_sequence_id);
+
+    Interpreter* interpreter = nullptr;
+
+    if (tagged) {
+      interpreter = work_queue->find_interpreter(sequence_id);
+      if (!interpreter) {
+        emit error_occurred(QString("Response to unknown command (sequence ID ")
+                          + QString::number(sequence_id)
+                          + QString(")."));
+        return;
+      }
+    } else if (work_queue->empty()) {
+      return;
+    } else {
+      interpreter = &work_queue->get_current_interpreter();
+    }
+
+    if (!interpreter->interpret_frame(out_decoder->get_payload(), out_decoder->get_payload_size())) {
+      emit error_occurred(QString("Malformed binary response."));
+    }
+
+    if (tagged) {
+      work_queue->remove(sequence_id, received_ns);
+    } else {
+      work_queue->pop(received_ns);
+    }
+  }
   /// Handles a line from the games standard output.
-  /// If no interpreter is active, then the line is ignored.
-  /// @param line The line emitted from the process.
-  void handle_line(const QString& line) {
+  /// If the line is the header of a tagged response,
+  /// then the lines of the response are gathered first.
+  /// Otherwise, the line is the response to the oldest
+  /// command. If no interpreter is active, then the line is ignored.
+  /// @param tokens The significant tokens of the line.
+  /// @param count The number of tokens in the line.
+  void handle_line(const protocol::Token* tokens, std::size_t count) {
+
+    ProfileScope scope("ProcessApi::handle_line");
+
+    if (parse_sequence_header(tokens, count, response_id, response_lines)) {
+      if (response_lines == 0) {
+        handle_tagged_response();
+      }
+      return;
+    }
 
     if (work_queue->empty()) {
       return;
     }
 
-    work_queue->get_current_interpreter().interpret_text(line);
+    work_queue->get_current_interpreter().interpret_tokens(tokens, count, response_arena);
 
-    work_queue->pop();
+    response_arena.reset();
+
+    work_queue->pop(received_ns);
+  }
+  /// Handles a complete tagged response, which is
+  /// passed to the interpreter of the command that
+  /// has a matching sequence ID.
+  void handle_tagged_response() {
+
+    auto* interpreter = work_queue->find_interpreter(response_id);
+    if (!interpreter) {
+      emit error_occurred(QString("Response to unknown command (sequence ID ")
+                        + QString::number(response_id)
+                        + QString(")."));
+      return;
+    }
+
+    // Skip the header tokens.
+    const std::size_t header_size = 3;
+
+    interpreter->interpret_tokens(out_lexer->get_tokens() + header_size,
+                                  out_lexer->get_token_count() - header_size,
+                                  response_arena);
+
+    response_arena.reset();
+
+    work_queue->remove(response_id, received_ns);
   }
   /// Handles a syntax error from the response.
   void handle_syntax_error(const protocol::SyntaxError& error) {
@@ -184,9 +475,13 @@ protected:
       connect(interpreter, &Interpreter::error, this, &ProcessApi::handle_syntax_error);
     }
 
+    if (pipelined) {
+      cmd->set_sequence_id(next_sequence_id++);
+    }
+
     send_command(*cmd);
 
-    work_queue->add(std::move(cmd), interpreter);
+    work_queue->add(std::move(cmd), interpreter, Profiler::now_ns());
   }
   /// Sends a command to the process.
   /// @param command The command to send.
@@ -206,10 +501,20 @@ class ProcessApiFactoryImpl final : public ProcessApiFactory {
   QString program;
   QString pwd;
   Model* model;
+  protocol::Encoding encoding;
+  bool batch_input;
+  bool pipelined;
 public:
-  ProcessApiFactoryImpl() : model(nullptr) {}
+  ProcessApiFactoryImpl()
+    : model(nullptr),
+      encoding(protocol::Encoding::Text),
+      batch_input(false),
+      pipelined(false) {}
   Api* make_process_api(QObject* parent) override {
     auto* process_api = new ProcessApi(model, parent);
+    process_api->set_encoding(encoding);
+    process_api->set_batch_input(batch_input);
+    process_api->set_pipelined(pipelined);
     process_api->set_working_directory(pwd);
     process_api->start(program, args);
     return process_api;
@@ -217,9 +522,18 @@ public:
   void set_args(const QStringList& args_) override {
     args = args_;
   }
+  void set_batch_input(bool batch_input_) override {
+    batch_input = batch_input_;
+  }
+  void set_encoding(protocol::Encoding encoding_) override {
+    encoding = encoding_;
+  }
   void set_model(Model* model_) override {
     model = model_;
   }
+  void set_pipelined(bool pipelined_) override {
+    pipelined = pipelined_;
+  }
   void set_program(const QString& program_) override {
     program = program_;
   }
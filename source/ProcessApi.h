@@ -12,6 +12,12 @@ class ScopedPtr;
 
 class Model;
 
+namespace protocol {
+
+enum class Encoding : int;
+
+} // namespace protocol
+
 /// Used for constructing process API instances.
 class ProcessApiFactory {
 public:
@@ -26,9 +32,24 @@ public:
   /// Sets the additional arguments to the process.
   /// @param args Additional arguments to assign the process.
   virtual void set_args(const QStringList& args) = 0;
+  /// Enables or disables input batching. When input batching
+  /// is enabled, the input updates of each frame are sent in
+  /// one "update_batch" command, instead of one command per update.
+  /// @param batch_input Whether or not to enable input batching.
+  virtual void set_batch_input(bool batch_input) = 0;
+  /// Assigns the encoding of the commands and responses.
+  /// The text encoding is used by default.
+  /// @param encoding The encoding to assign.
+  virtual void set_encoding(protocol::Encoding encoding) = 0;
   /// Assigns the model that the process API will be modifying.
   /// @param model A pointer to the game model to modify.
   virtual void set_model(Model* model) = 0;
+  /// Enables or disables pipelining. When pipelining is
+  /// enabled, each command is tagged with a sequence ID and
+  /// the game may send tagged responses in any order.
+  /// Untagged responses are still accepted in order.
+  /// @param pipelined Whether or not to enable pipelining.
+  virtual void set_pipelined(bool pipelined) = 0;
   /// Sets the path to the program to start.
   /// @param program The path to the program to start.
   virtual void set_program(const QString& program) = 0;
@@ -1,10 +1,13 @@
 #include "ResponseHandler.h"
 
+#include <herald/Camera.h>
+#include <herald/Index.h>
 #include <herald/Model.h>
-#include <herald/Object.h>
 #include <herald/ObjectTable.h>
 #include <herald/ScopedPtr.h>
+#include <herald/Vec2f.h>
 
+#include <herald/protocol/Binary.h>
 #include <herald/protocol/Parser.h>
 #include <herald/protocol/ParseTree.h>
 
@@ -36,6 +39,52 @@ public:
 
     node->accept(*this);
 
+    return true;
+  }
+  /// Interprets a binary response. The payload is a
+  /// series of statements, each starting with a uint32
+  /// statement opcode followed by its operands.
+  /// @param reader The reader of the response payload.
+  /// @returns True on success, false on failure.
+  bool interpret_binary(protocol::BinaryReader& reader) override {
+
+    while (!reader.done()) {
+
+      std::uint32_t opcode = 0;
+
+      if (!reader.read_u32(opcode)) {
+        return false;
+      }
+
+      if (opcode == (std::uint32_t) protocol::StmtOpcode::SetAction) {
+
+        std::int32_t object_id = 0;
+        std::int32_t action_id = 0;
+
+        if (!reader.read_i32(object_id)
+         || !reader.read_i32(action_id)) {
+          return false;
+        }
+
+        set_action(object_id, action_id);
+
+      } else if (opcode == (std::uint32_t) protocol::StmtOpcode::SetCamera) {
+
+        std::int32_t values[3] { 0, 0, 0 };
+
+        if (!reader.read_i32_array(values, 3)
+         || (values[2] < 0)
+         || (values[2] > protocol::max_tile_size)) {
+          return false;
+        }
+
+        set_camera(values[0], values[1], values[2]);
+
+      } else {
+        return false;
+      }
+    }
+
     return true;
   }
 protected:
@@ -61,14 +110,64 @@ protected:
       return;
     }
 
-    auto* object_table = model->get_object_table();
+    set_action(object_id, action_id);
+  }
+  /// Moves the camera of the model.
+  /// @param set_camera_stmt A reference to the statement
+  /// from the parse tree that contains the new camera position
+  /// and the size of the tiles on the screen.
+  void visit(const protocol::SetCameraStmt& set_camera_stmt) override {
+
+    int x = 0;
+    int y = 0;
+    int tile_size = 0;
+
+    auto x_node = set_camera_stmt.get_x();
+    auto y_node = set_camera_stmt.get_y();
+    auto tile_size_node = set_camera_stmt.get_tile_size();
+
+    if (!check(x_node)
+     || !check(y_node)
+     || !check(tile_size_node)) {
+      return;
+    }
+
+    if (!x_node.to_signed_value(x)
+     || !y_node.to_signed_value(y)
+     || !tile_size_node.to_signed_value(tile_size)) {
+      return;
+    }
 
-    auto* object = object_table->at((std::size_t) object_id);
-    if (!object) {
+    set_camera(x, y, tile_size);
+  }
+  /// Moves the camera of the model.
+  /// @param x The X coordinate to center the camera on, in tiles.
+  /// @param y The Y coordinate to center the camera on, in tiles.
+  /// @param tile_size The size of a tile on the screen, in pixels.
+  /// Zero fits the whole room into the window. Sizes above
+  /// @ref protocol::max_tile_size were already rejected, by
+  /// the syntax checker or while reading the binary frame.
+  void set_camera(int x, int y, int tile_size) {
+
+    auto* camera = model->get_camera();
+    if (!camera || (tile_size < 0)) {
+      return;
+    }
+
+    camera->set_position(Vec2f(x, y));
+    camera->set_tile_size((std::size_t) tile_size);
+  }
+  /// Assigns an object a different action.
+  /// @param object_id The ID of the object to modify.
+  /// @param action_id The ID of the action to assign.
+  void set_action(int object_id, int action_id) {
+
+    auto* object_table = model->get_object_table();
+    if (!object_table) {
       return;
     }
 
-    object->set_action_index((std::size_t) action_id);
+    object_table->set_action_index((std::size_t) object_id, (std::size_t) action_id);
   }
   /// Does nothing.
   void visit(const protocol::Integer&) override { }
@@ -6,11 +6,13 @@
 #include <herald/Tile.h>
 
 #include "Interpreter.h"
-#include "Matrix.h"
 
+#include <herald/protocol/Binary.h>
 #include <herald/protocol/ParseTree.h>
 #include <herald/protocol/Parser.h>
 
+#include <vector>
+
 using namespace herald;
 
 namespace {
@@ -29,24 +31,63 @@ public:
   /// @returns True on success, false on failure.
   bool interpret(protocol::Parser& parser) override {
 
-    auto matrix_node = parser.parse_matrix();
-    if (!check(*matrix_node)) {
+    auto matrix = parser.parse_matrix();
+    if (!check(*matrix)) {
       return false;
     }
 
-    auto matrix = Matrix::make(*matrix_node);
+    int w = 0;
+    int h = 0;
+
+    auto size = matrix->get_size();
+
+    if (!size.get_width().to_signed_value(w)
+     || !size.get_height().to_signed_value(h)) {
+      return false;
+    }
 
     auto* room = model->get_room();
 
-    room->resize((std::size_t) matrix->width(),
-                 (std::size_t) matrix->height());
+    room->resize((std::size_t) w, (std::size_t) h);
+
+    room->assign_animation_indices(matrix->get_values(), matrix->get_value_count());
+
+    model->prefetch_room_textures();
+
+    return true;
+  }
+  /// Interprets the binary response, which is the
+  /// width and height as uint32 values followed by
+  /// the packed int32 cells of the room, row by row.
+  /// @returns True on success, false on failure.
+  bool interpret_binary(protocol::BinaryReader& reader) override {
+
+    std::uint32_t w = 0;
+    std::uint32_t h = 0;
 
-    for (std::size_t y = 0; y < matrix->height(); y++) {
-      for (std::size_t x = 0; x < matrix->width(); x++) {
-        room->at(x, y)->set_animation_index((std::size_t) matrix->at(x, y));
-      }
+    if (!reader.read_u32(w)
+     || !reader.read_u32(h)) {
+      return false;
+    }
+
+    auto count = ((std::size_t) w) * h;
+
+    if ((reader.remaining() / 4) < count) {
+      return false;
     }
 
+    std::vector<std::int32_t> cells(count);
+
+    reader.read_i32_array(cells.data(), count);
+
+    auto* room = model->get_room();
+
+    room->resize(w, h);
+
+    room->assign_animation_indices(cells.data(), count);
+
+    model->prefetch_room_textures();
+
     return true;
   }
 };
@@ -2,7 +2,11 @@
 
 #include "PathSetting.h"
 
+#include <herald/Profiler.h>
+
+#include <QCheckBox>
 #include <QFormLayout>
+#include <QSignalBlocker>
 #include <QSettings>
 
 namespace {
@@ -17,6 +21,8 @@ class SettingsDialogImpl final : public SettingsDialog {
   PathSetting* java_setting;
   /// A pointer to the setting for the Python executable.
   PathSetting* python_setting;
+  /// Whether or not the frame stages are profiled.
+  QCheckBox* profiling_setting;
 public:
   /// Constructs an instance of the settings dialog.
   /// @param parent A pointer to the parent widget.
@@ -25,12 +31,17 @@ public:
     java_setting = PathSetting::make_java_setting(this);
     python_setting = PathSetting::make_python_setting(this);
 
+    profiling_setting = new QCheckBox(this);
+
     connect(java_setting,   &PathSetting::changed, this, &SettingsDialogImpl::update_java_executable);
     connect(python_setting, &PathSetting::changed, this, &SettingsDialogImpl::update_python_executable);
 
+    connect(profiling_setting, &QCheckBox::toggled, this, &SettingsDialogImpl::update_profiling);
+
     layout = new QFormLayout(this);
     layout->addRow(tr("Java Interpreter"), java_setting);
     layout->addRow(tr("Python Interpreter"), python_setting);
+    layout->addRow(tr("Profile Frames"), profiling_setting);
 
     setWindowTitle(tr("Settings"));
 
@@ -51,6 +62,13 @@ protected slots:
     QSettings settings;
     settings.setValue("Python", path);
   }
+  /// Turns the frame profiler on or off.
+  /// @param state Whether or not to profile frames.
+  void update_profiling(bool state) {
+    QSettings settings;
+    settings.setValue("Profiling", state);
+    herald::Profiler::set_enabled(state);
+  }
 protected:
   /// Loads the settings values.
   void load_settings() {
@@ -60,6 +78,13 @@ protected:
     java_setting->set_path(settings.value("Java").toString());
 
     python_setting->set_path(settings.value("Python").toString());
+
+    // The checkbox shows the saved setting, rather than whether
+    // the profiler is on, so that HERALD_PROFILE isn't saved.
+    // Signals are blocked, since loading isn't a change.
+    QSignalBlocker blocker(profiling_setting);
+
+    profiling_setting->setChecked(settings.value("Profiling").toBool());
   }
 };
 
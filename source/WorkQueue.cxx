@@ -1,11 +1,13 @@
 #include "WorkQueue.h"
 
+#include <herald/LatencyTable.h>
 #include <herald/ScopedPtr.h>
 
 #include <herald/protocol/Command.h>
 
 #include "Interpreter.h"
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -13,54 +15,186 @@ namespace herald {
 
 namespace {
 
-/// A type definition for an
-/// entry within the work queue.
-using WorkItem = std::pair<ScopedPtr<protocol::Command>, ScopedPtr<Interpreter>>;
+/// An entry within the work queue.
+struct WorkItem final {
+  /// The command that was sent to the game.
+  ScopedPtr<protocol::Command> command;
+  /// The interpreter for the response of the command.
+  ScopedPtr<Interpreter> interpreter;
+  /// When the command was sent, in nanoseconds.
+  std::uint64_t sent_ns = 0;
+  /// Whether or not the response was already
+  /// handled. Items are only marked like this
+  /// when they complete ahead of older items.
+  bool done = false;
+};
 
 /// The implementation of the work queue interface.
+/// The items are kept in a ring buffer, so that
+/// removing the oldest item does not shift the rest.
 class WorkQueueImpl final : public WorkQueue {
-  /// The items in the work queue.
-  std::vector<WorkItem> items;
+  /// The ring buffer of work items.
+  /// The size of this is always a power of two.
+  std::vector<WorkItem> slots;
+  /// The slot of the oldest item.
+  std::size_t head;
+  /// The number of slots in use, starting at
+  /// the head. This includes completed items
+  /// that are waiting on older ones.
+  std::size_t used;
+  /// The number of items still waiting for a response.
+  std::size_t pending;
+  /// The latencies of the completed items.
+  LatencyTable latency_table;
   /// A "null" command instance.
   ScopedPtr<protocol::Command> null_command;
   /// A "null" interpreter instance.
   ScopedPtr<Interpreter> null_interpreter;
 public:
   /// Constructs a new work queue implementation instance.
-  WorkQueueImpl() : null_command(protocol::Command::make_null()),
+  WorkQueueImpl() : slots(16),
+                    head(0),
+                    used(0),
+                    pending(0),
+                    null_command(protocol::Command::make_null()),
                     null_interpreter(Interpreter::make_null(nullptr)) {
 
   }
   /// Adds an item to the work queue.
-  /// @param command
-  void add(ScopedPtr<protocol::Command>&& cmd, Interpreter* interpreter) override {
-    return items.emplace_back(std::move(cmd), interpreter);
+  /// @param cmd The command that was sent.
+  /// @param interpreter The interpreter for the response.
+  /// @param sent_ns When the command was sent.
+  void add(ScopedPtr<protocol::Command>&& cmd, Interpreter* interpreter, std::uint64_t sent_ns) override {
+
+    if (used == slots.size()) {
+      grow();
+    }
+
+    auto& item = slot(used++);
+    item.command = std::move(cmd);
+    item.interpreter = ScopedPtr<Interpreter>(interpreter);
+    item.sent_ns = sent_ns;
+    item.done = false;
+
+    pending++;
   }
   /// Indicates whether or not the queue is empty.
   bool empty() const noexcept override {
-    return items.empty();
+    return pending == 0;
+  }
+  /// Indicates the number of pending items.
+  std::size_t size() const noexcept override {
+    return pending;
   }
   /// Gets the current command pointer.
   const protocol::Command& get_current_command() const noexcept override {
-    if (items.empty()) {
+    if (empty()) {
       return *null_command;
     } else {
-      return *items[0].first;
+      return *slots[head].command;
     }
   }
   /// Gets the current interpreter pointer.
   Interpreter& get_current_interpreter() noexcept override {
-    if (items.empty()) {
-      return *null_interpreter;
-    } else if (!items[0].second) {
+    if (empty()) {
       return *null_interpreter;
     } else {
-      return *items[0].second;
+      return interpreter_of(slots[head]);
     }
   }
+  /// Gets the time that the current command was sent.
+  std::uint64_t get_current_send_time() const noexcept override {
+    return empty() ? 0 : slots[head].sent_ns;
+  }
   /// Removes the current work item.
-  void pop() override {
-    items.erase(items.begin());
+  void pop(std::uint64_t received_ns) override {
+    if (!empty()) {
+      release(slots[head], received_ns);
+      skip_done();
+    }
+  }
+  /// Finds the interpreter of a pending item.
+  Interpreter* find_interpreter(std::size_t sequence_id) noexcept override {
+    auto* item = find(sequence_id);
+    return item ? &interpreter_of(*item) : nullptr;
+  }
+  /// Removes a pending item by its sequence ID.
+  bool remove(std::size_t sequence_id, std::uint64_t received_ns) override {
+
+    auto* item = find(sequence_id);
+    if (!item) {
+      return false;
+    }
+
+    release(*item, received_ns);
+
+    skip_done();
+
+    return true;
+  }
+  /// Accesses the latencies of the completed items.
+  const LatencyTable& get_latency_table() const noexcept override {
+    return latency_table;
+  }
+protected:
+  /// Accesses a slot relative to the head of the queue.
+  /// @param offset The offset from the head of the queue.
+  WorkItem& slot(std::size_t offset) noexcept {
+    return slots[(head + offset) & (slots.size() - 1)];
+  }
+  /// Finds a pending item by its sequence ID.
+  /// @returns A pointer to the item, or null if it wasn't found.
+  WorkItem* find(std::size_t sequence_id) noexcept {
+    for (std::size_t i = 0; i < used; i++) {
+      auto& item = slot(i);
+      if (!item.done
+       && item.command->has_sequence_id()
+       && (item.command->get_sequence_id() == sequence_id)) {
+        return &item;
+      }
+    }
+    return nullptr;
+  }
+  /// Gets the interpreter of an item,
+  /// or the null interpreter if it has none.
+  Interpreter& interpreter_of(WorkItem& item) noexcept {
+    return item.interpreter ? *item.interpreter : *null_interpreter;
+  }
+  /// Records the latency of an item, then
+  /// destroys its contents and marks it as done.
+  /// @param received_ns When the response to the item arrived.
+  void release(WorkItem& item, std::uint64_t received_ns) {
+    auto latency_ns = (received_ns > item.sent_ns) ? (received_ns - item.sent_ns) : 0;
+    latency_table.record(item.command->get_name(), latency_ns);
+    item.command.destroy();
+    item.interpreter.destroy();
+    item.done = true;
+    pending--;
+  }
+  /// Advances the head past the items that are done.
+  void skip_done() noexcept {
+    while ((used > 0) && slots[head].done) {
+      slots[head].done = false;
+      head = (head + 1) & (slots.size() - 1);
+      used--;
+    }
+  }
+  /// Doubles the number of slots in the ring buffer.
+  void grow() {
+
+    std::vector<WorkItem> next(slots.size() * 2);
+
+    for (std::size_t i = 0; i < used; i++) {
+      auto& item = slot(i);
+      next[i].command = std::move(item.command);
+      next[i].interpreter = std::move(item.interpreter);
+      next[i].sent_ns = item.sent_ns;
+      next[i].done = item.done;
+    }
+
+    slots.swap(next);
+
+    head = 0;
   }
 };
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 class Interpreter;
 
 namespace herald {
@@ -7,10 +10,20 @@ namespace herald {
 template <typename T>
 class ScopedPtr;
 
+class LatencyTable;
+
 namespace protocol { class Command; }
 
 /// Used for queing work items
 /// to be handled by the game and game engine.
+/// Commands stay in the queue until their response
+/// arrives. Responses normally arrive in the order
+/// that the commands were sent, but commands with
+/// a sequence ID may be completed out of order.
+///
+/// Each item keeps the time its command was sent. When
+/// the response arrives, the time between the two is
+/// recorded under the name of the command.
 class WorkQueue {
 public:
   /// Creates a new work queue.
@@ -20,10 +33,14 @@ public:
   /// Adds a command and an interpreter to the work queue.
   /// @param command The command to add.
   /// @param interpreter The interpreter instance to add.
-  virtual void add(ScopedPtr<protocol::Command>&& command, Interpreter* interpreter) = 0;
+  /// @param sent_ns When the command was sent, in nanoseconds.
+  virtual void add(ScopedPtr<protocol::Command>&& command, Interpreter* interpreter, std::uint64_t sent_ns) = 0;
   /// Indicates whether or not the work queue is empty.
   /// @returns True if the work queue is empty, false if it's not.
   virtual bool empty() const noexcept = 0;
+  /// Indicates the number of commands that are
+  /// still waiting for a response.
+  virtual std::size_t size() const noexcept = 0;
   /// Gets the current command in the work queue.
   /// If the work queue is empty, then a command
   /// is returned which as a data size of zero.
@@ -32,8 +49,32 @@ public:
   /// If the work queue is empty, then an interpreter
   /// is returned that does nothing.
   virtual Interpreter& get_current_interpreter() noexcept = 0;
+  /// Gets the time that the current command was sent.
+  /// Since the current command is the oldest one still
+  /// waiting, this tells how long the game has been stuck.
+  /// @returns The time the command was sent, in nanoseconds.
+  /// If the work queue is empty, then zero is returned.
+  virtual std::uint64_t get_current_send_time() const noexcept = 0;
   /// Removes the current item from the work queue.
-  virtual void pop() = 0;
+  /// @param received_ns When the response to the item arrived.
+  virtual void pop(std::uint64_t received_ns) = 0;
+  /// Finds the interpreter of a command that is
+  /// still waiting for a response.
+  /// @param sequence_id The sequence ID of the command.
+  /// @returns The interpreter of the command. If no command
+  /// in the queue has the sequence ID, then a null pointer
+  /// is returned instead.
+  virtual Interpreter* find_interpreter(std::size_t sequence_id) noexcept = 0;
+  /// Removes the command with a certain sequence ID.
+  /// Commands that were sent before it stay in the queue.
+  /// @param sequence_id The sequence ID of the command to remove.
+  /// @param received_ns When the response to the command arrived.
+  /// @returns True if the command was found and removed,
+  /// false if it was not found.
+  virtual bool remove(std::size_t sequence_id, std::uint64_t received_ns) = 0;
+  /// Accesses the latencies of the commands that were
+  /// completed, grouped by the name of the command.
+  virtual const LatencyTable& get_latency_table() const noexcept = 0;
 };
 
 } // namespace herald
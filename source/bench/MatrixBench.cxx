@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Arena.h>
+#include <herald/protocol/Lexer.h>
+#include <herald/protocol/ParseTree.h>
+#include <herald/protocol/Parser.h>
+
+#include "Matrix.h"
+
+#include <string>
+
+using namespace herald;
+
+namespace {
+
+/// Converts a parsed room matrix into the matrix
+/// that the room builder reads the tiles from.
+void BM_MatrixMake(benchmark::State& state) {
+
+  auto side = (std::size_t) state.range(0);
+
+  std::string text = std::to_string(side) + " " + std::to_string(side);
+
+  for (std::size_t i = 0; i < (side * side); i++) {
+    text += ' ';
+    text += std::to_string((i * 7919) % 1000);
+  }
+
+  text += '\n';
+
+  auto lexer = protocol::StreamLexer::make();
+
+  lexer->write(text.data(), text.size());
+
+  lexer->next_line();
+
+  protocol::Arena arena;
+
+  auto* parsed = protocol::Parser::make(lexer->get_tokens(), lexer->get_token_count(), arena)->parse_matrix();
+
+  for (auto _ : state) {
+    auto matrix = Matrix::make(*parsed);
+    benchmark::DoNotOptimize(matrix->at(side - 1, side - 1));
+  }
+
+  state.SetItemsProcessed((int64_t) (state.iterations() * side * side));
+}
+
+} // namespace
+
+BENCHMARK(BM_MatrixMake)->ArgName("side")->Arg(16)->Arg(128)->Arg(1024);
@@ -33,6 +33,10 @@ public:
   void clear() override {
     actions.clear();
   }
+  /// Indicates the number of actions in the table.
+  std::size_t size() const noexcept override {
+    return actions.size();
+  }
 };
 
 } // namespace
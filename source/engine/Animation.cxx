@@ -3,6 +3,7 @@
 #include <herald/Index.h>
 #include <herald/ScopedPtr.h>
 
+#include <algorithm>
 #include <vector>
 
 namespace herald {
@@ -15,63 +16,149 @@ public:
   /// Does nothing.
   void add_frame(Index, std::size_t) override {}
   /// Does nothing.
+  void reserve(std::size_t) override {}
+  /// Does nothing.
   /// @returns An invalid index.
   Index calculate_texture_index(std::size_t) const noexcept override {
     return Index();
   }
+  /// Does nothing.
+  /// @returns SIZE_MAX, since the animation never changes.
+  std::size_t calculate_next_change(std::size_t) const noexcept override {
+    return SIZE_MAX;
+  }
+  /// Does nothing.
+  /// @returns Zero, since there are no frames.
+  std::size_t get_frame_count() const noexcept override {
+    return 0;
+  }
+  /// Does nothing.
+  /// @returns An invalid index.
+  Index get_frame_texture(std::size_t) const noexcept override {
+    return Index();
+  }
 };
 
 NullAnimation null_animation;
 
-/// Represents a single entry within an animation.
-struct Frame final {
-  /// The index of the texture that displays during this frame.
-  Index texture;
-  /// The number of milliseconds the frame should last.
-  std::size_t delay_ms;
-  /// Constructs a new frame instance with default data.
-  constexpr Frame() noexcept : delay_ms(SIZE_MAX) {}
-  /// Constructs a new frame with initialized data.
-  /// @param t The index of the texture to display.
-  /// @param d The delay, in milliseconds, of the frame.
-  constexpr Frame(Index t, std::size_t d) : texture(t), delay_ms(d) {}
-};
-
 /// The implementation of the animation interface.
+/// The end time of every frame is kept in a prefix array,
+/// so that the frame for a point in time is found with
+/// a binary search. If all frames have the same delay,
+/// the frame is found with a single division instead.
 class AnimationImpl final : public Animation {
-  /// The animation frame describe how
-  /// the animation plays throughout its period of time.
-  std::vector<Frame> frames;
-  /// The total duration of the animation.
-  std::size_t duration_ms;
+  /// The texture displayed by each frame.
+  std::vector<Index> textures;
+  /// The time at which each frame ends, relative
+  /// to the start of the animation. This is the
+  /// running sum of the frame delays.
+  std::vector<std::size_t> frame_ends;
+  /// The delay shared by all the frames, or zero
+  /// if the frames don't all have the same delay.
+  std::size_t uniform_delay_ms;
+  /// The number of frames that have a non-zero delay.
+  std::size_t timed_frame_count;
 public:
   /// Constructs a new instance of the animation implementation.
-  AnimationImpl() : duration_ms(0) {}
+  AnimationImpl() : uniform_delay_ms(0), timed_frame_count(0) {}
   /// Adds a frame to the animation.
   /// @param texture The index of the texture to display for the frame.
   /// @param delay_ms The number of milliseconds the frame should last.
   void add_frame(Index texture, std::size_t delay_ms) override {
-    frames.emplace_back(texture, delay_ms);
-    duration_ms += delay_ms;
+
+    auto duration_ms = get_duration();
+
+    // Saturate, so that a frame lasting "forever"
+    // doesn't wrap the duration back around.
+    auto end_ms = ((SIZE_MAX - duration_ms) < delay_ms) ? SIZE_MAX : (duration_ms + delay_ms);
+
+    if (textures.empty()) {
+      uniform_delay_ms = delay_ms;
+    } else if (uniform_delay_ms != delay_ms) {
+      uniform_delay_ms = 0;
+    }
+
+    textures.emplace_back(texture);
+
+    frame_ends.emplace_back(end_ms);
+
+    timed_frame_count += delay_ms ? 1 : 0;
+  }
+  /// Reserves space for a number of frames.
+  /// @param frame_count The number of frames to reserve space for.
+  void reserve(std::size_t frame_count) override {
+    textures.reserve(frame_count);
+    frame_ends.reserve(frame_count);
   }
   /// Calculates the index of the texture that should be displayed.
   /// @param ellapsed_ms The total number of ellapsed milliseconds for the game play.
   /// @returns The index of the texture that should be displayed.
+  /// If the animation has no duration, an invalid index is returned.
   Index calculate_texture_index(std::size_t ellapsed_ms) const noexcept override {
 
+    auto duration_ms = get_duration();
+    if (!duration_ms) {
+      return Index();
+    }
+
     ellapsed_ms %= duration_ms;
 
-    decltype(ellapsed_ms) ellapsed_animation = 0;
+    if (uniform_delay_ms) {
+      return textures[ellapsed_ms / uniform_delay_ms];
+    }
 
-    for (auto& frame : frames) {
-      if ((ellapsed_ms >= ellapsed_animation) && (ellapsed_ms < (ellapsed_animation + frame.delay_ms))) {
-        return frame.texture;
-      } else {
-        ellapsed_animation += frame.delay_ms;
-      }
+    // The first frame that ends after the point in time.
+    auto it = std::upper_bound(frame_ends.begin(), frame_ends.end(), ellapsed_ms);
+
+    return textures[(std::size_t) (it - frame_ends.begin())];
+  }
+  /// Calculates the point in time that the next frame starts.
+  /// @param ellapsed_ms The current point in time.
+  /// @returns The start of the next frame, or SIZE_MAX if
+  /// the animation doesn't have more than one frame to show.
+  std::size_t calculate_next_change(std::size_t ellapsed_ms) const noexcept override {
+
+    auto duration_ms = get_duration();
+
+    if (timed_frame_count < 2) {
+      return SIZE_MAX;
     }
 
-    return Index();
+    auto offset_ms = ellapsed_ms % duration_ms;
+
+    std::size_t frame_end_ms = 0;
+
+    // A saturated duration may not be a multiple of
+    // the delay, so the search is used in that case.
+    if (uniform_delay_ms && (duration_ms != SIZE_MAX)) {
+      frame_end_ms = ((offset_ms / uniform_delay_ms) + 1) * uniform_delay_ms;
+    } else {
+      frame_end_ms = *std::upper_bound(frame_ends.begin(), frame_ends.end(), offset_ms);
+    }
+
+    auto remaining_ms = frame_end_ms - offset_ms;
+
+    if ((SIZE_MAX - ellapsed_ms) <= remaining_ms) {
+      return SIZE_MAX;
+    }
+
+    return ellapsed_ms + remaining_ms;
+  }
+  /// Indicates the number of frames in the animation.
+  std::size_t get_frame_count() const noexcept override {
+    return textures.size();
+  }
+  /// Accesses the texture of a frame.
+  /// @param frame The index of the frame.
+  /// @returns The texture of the frame, or an
+  /// invalid index if the frame is out of bounds.
+  Index get_frame_texture(std::size_t frame) const noexcept override {
+    return (frame < textures.size()) ? textures[frame] : Index();
+  }
+protected:
+  /// Accesses the total duration of the animation.
+  inline std::size_t get_duration() const noexcept {
+    return frame_ends.empty() ? 0 : frame_ends.back();
   }
 };
 
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/Index.h>
+#include <herald/ScopedPtr.h>
+
+#include "HeadlessObjectTable.h"
+
+using namespace herald;
+
+namespace {
+
+/// Looks up the texture of an animation with many frames,
+/// at a time that moves forward by one frame of the game.
+void BM_AnimationTextureIndex(benchmark::State& state) {
+
+  auto frame_count = (std::size_t) state.range(0);
+
+  auto animation = Animation::make();
+
+  animation->reserve(frame_count);
+
+  for (std::size_t i = 0; i < frame_count; i++) {
+    animation->add_frame(Index(i), 10 + (i % 7));
+  }
+
+  std::size_t ellapsed_ms = 0;
+
+  for (auto _ : state) {
+    ellapsed_ms += 16;
+    benchmark::DoNotOptimize(animation->calculate_texture_index(ellapsed_ms));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/// Updates the animation indices of a headless object table,
+/// going through the object table interface like the models do.
+void BM_ObjectTableAnimationIndices(benchmark::State& state) {
+
+  const std::size_t action_count = 16;
+
+  auto actions = ActionTable::make();
+
+  for (std::size_t i = 0; i < action_count; i++) {
+    actions->add(Action(Index(i)));
+  }
+
+  auto count = (std::size_t) state.range(0);
+
+  auto objects = HeadlessObjectTable::make();
+
+  objects->resize(count);
+
+  for (std::size_t i = 0; i < count; i++) {
+    objects->set_action_index(Index(i), Index((i * 7) % action_count));
+  }
+
+  ObjectTable* table = objects.get();
+
+  for (auto _ : state) {
+    table->update_animation_indices(*actions);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed((int64_t) (state.iterations() * count));
+}
+
+} // namespace
+
+BENCHMARK(BM_AnimationTextureIndex)->ArgName("frames")->Arg(16)->Arg(1024)->Arg(65536);
+
+BENCHMARK(BM_ObjectTableAnimationIndices)->ArgName("objects")->Arg(1000)->Arg(100000);
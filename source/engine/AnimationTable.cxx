@@ -10,20 +10,43 @@ namespace herald {
 
 namespace {
 
+/// A texture index calculated for one tick.
+struct CachedFrame final {
+  /// The texture index of the animation.
+  Index texture;
+  /// The tick that the texture index was calculated for.
+  std::size_t tick;
+  /// Constructs an entry that isn't valid for any tick.
+  constexpr CachedFrame() noexcept : tick(0) {}
+};
+
 /// Implements the animation table interface.
 class AnimationTableImpl final : public AnimationTable {
   /// The animation container.
   std::vector<ScopedPtr<Animation>> animations;
+  /// The texture index of each animation,
+  /// for the tick that it was last calculated in.
+  mutable std::vector<CachedFrame> frames;
+  /// The point in time of the current tick.
+  mutable std::size_t tick_ms;
+  /// A counter that's incremented each time the point
+  /// in time changes. Cached frames from other ticks
+  /// are recognized by having a different count.
+  mutable std::size_t tick;
 public:
+  /// Constructs an empty animation table.
+  AnimationTableImpl() : tick_ms(0), tick(1) {}
   /// Adds an animation to the table.
   /// @param animation The animation to add.
   void add(ScopedPtr<Animation>&& animation) override {
     animations.emplace_back(std::move(animation));
+    frames.emplace_back();
   }
   /// Adds a single frame animation.
   /// @param texture_index The index of the texture containing the frame.
   void add_still_frame(Index texture_index) override {
     animations.emplace_back(Animation::make_single_frame(texture_index));
+    frames.emplace_back();
   }
   /// Accesses an animation at a specified index.
   const Animation* at(Index index) const noexcept override {
@@ -33,6 +56,32 @@ public:
       return animations[index].get();
     }
   }
+  /// Indicates the number of animations in the table.
+  std::size_t size() const noexcept override {
+    return animations.size();
+  }
+  /// Calculates the texture index of an animation,
+  /// reusing the result from earlier in the same tick.
+  Index calculate_texture_index(Index index, std::size_t ellapsed_ms) const noexcept override {
+
+    if (index >= animations.size()) {
+      return Index();
+    }
+
+    if (ellapsed_ms != tick_ms) {
+      tick_ms = ellapsed_ms;
+      tick++;
+    }
+
+    auto& frame = frames[index];
+
+    if (frame.tick != tick) {
+      frame.texture = animations[index]->calculate_texture_index(ellapsed_ms);
+      frame.tick = tick;
+    }
+
+    return frame.texture;
+  }
 };
 
 } // namespace
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/ScopedPtr.h>
+
+#include <cstdint>
+
+using namespace herald;
+
+TEST(Animation, UniformDelay) {
+
+  auto animation = Animation::make();
+  animation->add_frame(Index(4), 50);
+  animation->add_frame(Index(5), 50);
+  animation->add_frame(Index(6), 50);
+
+  EXPECT_EQ(animation->calculate_texture_index(0), 4);
+  EXPECT_EQ(animation->calculate_texture_index(49), 4);
+  EXPECT_EQ(animation->calculate_texture_index(50), 5);
+  EXPECT_EQ(animation->calculate_texture_index(149), 6);
+  EXPECT_EQ(animation->calculate_texture_index(150), 4);
+}
+
+TEST(Animation, MixedDelay) {
+
+  auto animation = Animation::make();
+  animation->add_frame(Index(1), 10);
+  animation->add_frame(Index(2), 0);
+  animation->add_frame(Index(3), 30);
+  animation->add_frame(Index(4), 60);
+
+  EXPECT_EQ(animation->calculate_texture_index(0), 1);
+  EXPECT_EQ(animation->calculate_texture_index(9), 1);
+  EXPECT_EQ(animation->calculate_texture_index(10), 3);
+  EXPECT_EQ(animation->calculate_texture_index(39), 3);
+  EXPECT_EQ(animation->calculate_texture_index(40), 4);
+  EXPECT_EQ(animation->calculate_texture_index(99), 4);
+  EXPECT_EQ(animation->calculate_texture_index(100), 1);
+}
+
+TEST(Animation, Empty) {
+
+  auto animation = Animation::make();
+
+  EXPECT_EQ(animation->calculate_texture_index(10).valid(), false);
+
+  animation->add_frame(Index(1), 0);
+
+  EXPECT_EQ(animation->calculate_texture_index(10).valid(), false);
+}
+
+TEST(Animation, SingleFrame) {
+
+  auto animation = Animation::make_single_frame(Index(7));
+
+  EXPECT_EQ(animation->calculate_texture_index(0), 7);
+  EXPECT_EQ(animation->calculate_texture_index(SIZE_MAX - 1), 7);
+}
+
+TEST(Animation, CalculateNextChange) {
+
+  auto animation = Animation::make();
+  animation->add_frame(Index(1), 10);
+  animation->add_frame(Index(2), 30);
+
+  EXPECT_EQ(animation->calculate_next_change(0), 10);
+  EXPECT_EQ(animation->calculate_next_change(10), 40);
+  EXPECT_EQ(animation->calculate_next_change(39), 40);
+  EXPECT_EQ(animation->calculate_next_change(45), 50);
+
+  auto still = Animation::make_single_frame(Index(3));
+
+  EXPECT_EQ(still->calculate_next_change(0), SIZE_MAX);
+}
+
+TEST(Animation, FrameTextures) {
+
+  auto animation = Animation::make();
+  animation->add_frame(Index(4), 100);
+  animation->add_frame(Index(7), 0);
+
+  EXPECT_EQ(animation->get_frame_count(), 2);
+  EXPECT_EQ(animation->get_frame_texture(0), 4);
+  EXPECT_EQ(animation->get_frame_texture(1), 7);
+  EXPECT_EQ(animation->get_frame_texture(2).valid(), false);
+
+  EXPECT_EQ(Animation::get_null_animation()->get_frame_count(), 0);
+}
+
+TEST(AnimationTable, CalculateTextureIndex) {
+
+  auto animations = AnimationTable::make();
+
+  auto animation = Animation::make();
+  animation->add_frame(Index(0), 100);
+  animation->add_frame(Index(1), 100);
+  animations->add(std::move(animation));
+
+  animations->add_still_frame(Index(9));
+
+  EXPECT_EQ(animations->calculate_texture_index(Index(0), 50), 0);
+  EXPECT_EQ(animations->calculate_texture_index(Index(0), 50), 0);
+  EXPECT_EQ(animations->calculate_texture_index(Index(1), 50), 9);
+  EXPECT_EQ(animations->calculate_texture_index(Index(0), 150), 1);
+  EXPECT_EQ(animations->calculate_texture_index(Index(1), 150), 9);
+  EXPECT_EQ(animations->calculate_texture_index(Index(0), 50), 0);
+  EXPECT_EQ(animations->calculate_texture_index(Index(2), 50).valid(), false);
+}
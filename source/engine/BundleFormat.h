@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace herald {
+
+/// The layout of a game bundle file.
+///
+/// A bundle starts with a @ref BundleHeader, which gives the
+/// location of four tables: the animation index of every action,
+/// the frame range of every animation, the frames themselves, and
+/// the size and pixel location of every texture. The tables are
+/// aligned to 8 bytes and the pixels of every texture are aligned
+/// to @ref bundle::pixel_alignment, so that all of them can be used
+/// straight out of a mapped file.
+///
+/// Values are written in the byte order of the machine that made the
+/// bundle. The @ref bundle::byte_order marker is checked when reading,
+/// so a bundle from a machine of the other byte order is rejected.
+namespace bundle {
+
+/// Identifies a bundle file.
+constexpr char magic[8] = { 'H', 'B', 'U', 'N', 'D', 'L', 'E', '\0' };
+
+/// The version of the bundle layout.
+constexpr std::uint32_t version = 1;
+
+/// Written as a native value to detect the byte order.
+constexpr std::uint32_t byte_order = 0x01020304;
+
+/// Used for indices that are invalid.
+constexpr std::uint32_t invalid_index = 0xffffffff;
+
+/// The delay of a frame that lasts forever. Delays
+/// that don't fit in 32 bits are saturated to this.
+constexpr std::uint32_t endless_delay = 0xffffffff;
+
+/// The alignment of every table.
+constexpr std::size_t table_alignment = 8;
+
+/// The alignment of the pixels of every texture.
+constexpr std::size_t pixel_alignment = 64;
+
+} // namespace bundle
+
+/// The header at the start of a bundle.
+struct BundleHeader final {
+  /// Equal to @ref bundle::magic.
+  char magic[8];
+  /// Equal to @ref bundle::version.
+  std::uint32_t version;
+  /// Equal to @ref bundle::byte_order.
+  std::uint32_t byte_order;
+  /// The number of actions.
+  std::uint32_t action_count;
+  /// The number of animations.
+  std::uint32_t animation_count;
+  /// The number of frames, across all animations.
+  std::uint32_t frame_count;
+  /// The number of textures.
+  std::uint32_t texture_count;
+  /// The location of the animation index of every action.
+  std::uint64_t actions_offset;
+  /// The location of the @ref BundleAnimation table.
+  std::uint64_t animations_offset;
+  /// The location of the @ref BundleFrame table.
+  std::uint64_t frames_offset;
+  /// The location of the @ref BundleTexture table.
+  std::uint64_t textures_offset;
+  /// The size of the whole bundle.
+  std::uint64_t file_size;
+};
+
+/// The frames of one animation.
+struct BundleAnimation final {
+  /// The index of the animation's first frame.
+  std::uint32_t first_frame;
+  /// The number of frames in the animation.
+  std::uint32_t frame_count;
+};
+
+/// A single animation frame.
+struct BundleFrame final {
+  /// The texture displayed by the frame.
+  std::uint32_t texture;
+  /// The number of milliseconds the frame lasts.
+  std::uint32_t delay_ms;
+};
+
+/// A texture in the bundle. The pixels are premultiplied
+/// ARGB words, one row after the other, without padding.
+struct BundleTexture final {
+  /// The width of the texture, in pixels.
+  std::uint32_t width;
+  /// The height of the texture, in pixels.
+  std::uint32_t height;
+  /// The location of the texture's pixels.
+  std::uint64_t pixels_offset;
+};
+
+static_assert(sizeof(BundleHeader) == 72, "Bundle header must not be padded.");
+static_assert(sizeof(BundleAnimation) == 8, "Bundle animation must not be padded.");
+static_assert(sizeof(BundleFrame) == 8, "Bundle frame must not be padded.");
+static_assert(sizeof(BundleTexture) == 16, "Bundle texture must not be padded.");
+
+} // namespace herald
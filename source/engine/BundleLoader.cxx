@@ -0,0 +1,53 @@
+#include <herald/BundleLoader.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/BundleReader.h>
+#include <herald/Model.h>
+#include <herald/Profiler.h>
+#include <herald/ScopedPtr.h>
+#include <herald/TextureTable.h>
+
+#include <utility>
+
+namespace herald {
+
+bool load_bundle_model(Model* model, const BundleReader& bundle) {
+
+  ProfileScope scope("load_bundle_model");
+
+  auto* action_table = model->get_action_table();
+  auto* animation_table = model->get_animation_table();
+  auto* texture_table = model->get_texture_table();
+
+  if (!action_table || !animation_table || !texture_table) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < bundle.get_texture_count(); i++) {
+    texture_table->open_pixels(bundle.get_texture_pixels(i),
+                               bundle.get_texture_width(i),
+                               bundle.get_texture_height(i));
+  }
+
+  for (std::size_t i = 0; i < bundle.get_animation_count(); i++) {
+
+    auto animation = Animation::make();
+
+    for (std::size_t j = 0; j < bundle.get_frame_count(i); j++) {
+      animation->add_frame(bundle.get_frame_texture(i, j), bundle.get_frame_delay(i, j));
+    }
+
+    animation_table->add(std::move(animation));
+  }
+
+  for (std::size_t i = 0; i < bundle.get_action_count(); i++) {
+    action_table->add(Action(bundle.get_action_animation(i)));
+  }
+
+  return true;
+}
+
+} // namespace herald
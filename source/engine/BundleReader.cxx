@@ -0,0 +1,150 @@
+#include <herald/BundleReader.h>
+
+#include "BundleFormat.h"
+
+#include <cstring>
+
+namespace herald {
+
+namespace {
+
+/// Checks that a table lies within the bundle.
+/// @param offset The location of the table.
+/// @param count The number of entries in the table.
+/// @param entry_size The size of one entry.
+/// @param alignment The alignment the table must have.
+/// @param size The size of the bundle.
+/// @returns True if the table is valid, false otherwise.
+bool check_range(std::uint64_t offset,
+                 std::uint64_t count,
+                 std::uint64_t entry_size,
+                 std::uint64_t alignment,
+                 std::uint64_t size) noexcept {
+
+  if ((offset % alignment) || (offset > size)) {
+    return false;
+  }
+
+  // Written as a division, so that it can't overflow.
+  return count <= ((size - offset) / entry_size);
+}
+
+/// Converts a stored index to a regular index.
+inline Index expand(std::uint32_t index) noexcept {
+  return (index == bundle::invalid_index) ? Index() : Index(index);
+}
+
+} // namespace
+
+BundleReader::BundleReader() noexcept
+  : actions(nullptr),
+    animations(nullptr),
+    frames(nullptr),
+    textures(nullptr),
+    base(nullptr),
+    action_count(0),
+    animation_count(0),
+    texture_count(0) {}
+
+bool BundleReader::open(const void* data, std::size_t size) noexcept {
+
+  *this = BundleReader();
+
+  const auto* bytes = (const unsigned char*) data;
+
+  if (!bytes
+   || (((std::uintptr_t) bytes) % bundle::table_alignment)
+   || (size < sizeof(BundleHeader))) {
+    return false;
+  }
+
+  BundleHeader header;
+
+  std::memcpy(&header, bytes, sizeof(header));
+
+  if ((std::memcmp(header.magic, bundle::magic, sizeof(header.magic)) != 0)
+   || (header.version != bundle::version)
+   || (header.byte_order != bundle::byte_order)
+   || (header.file_size != size)) {
+    return false;
+  }
+
+  if (!check_range(header.actions_offset, header.action_count, sizeof(std::uint32_t), bundle::table_alignment, size)
+   || !check_range(header.animations_offset, header.animation_count, sizeof(BundleAnimation), bundle::table_alignment, size)
+   || !check_range(header.frames_offset, header.frame_count, sizeof(BundleFrame), bundle::table_alignment, size)
+   || !check_range(header.textures_offset, header.texture_count, sizeof(BundleTexture), bundle::table_alignment, size)) {
+    return false;
+  }
+
+  const auto* animation_table = (const BundleAnimation*) (bytes + header.animations_offset);
+  const auto* frame_table = (const BundleFrame*) (bytes + header.frames_offset);
+  const auto* texture_table = (const BundleTexture*) (bytes + header.textures_offset);
+
+  for (std::uint32_t i = 0; i < header.animation_count; i++) {
+    const auto& animation = animation_table[i];
+    if ((animation.first_frame > header.frame_count)
+     || (animation.frame_count > (header.frame_count - animation.first_frame))) {
+      return false;
+    }
+  }
+
+  for (std::uint32_t i = 0; i < header.frame_count; i++) {
+    auto texture = frame_table[i].texture;
+    if ((texture != bundle::invalid_index) && (texture >= header.texture_count)) {
+      return false;
+    }
+  }
+
+  for (std::uint32_t i = 0; i < header.texture_count; i++) {
+
+    const auto& texture = texture_table[i];
+
+    auto pixel_count = ((std::uint64_t) texture.width) * ((std::uint64_t) texture.height);
+
+    if (!check_range(texture.pixels_offset, pixel_count, sizeof(std::uint32_t), sizeof(std::uint32_t), size)) {
+      return false;
+    }
+  }
+
+  actions = (const std::uint32_t*) (bytes + header.actions_offset);
+  animations = animation_table;
+  frames = frame_table;
+  textures = texture_table;
+  base = bytes;
+  action_count = header.action_count;
+  animation_count = header.animation_count;
+  texture_count = header.texture_count;
+
+  return true;
+}
+
+Index BundleReader::get_action_animation(std::size_t action) const noexcept {
+  return expand(actions[action]);
+}
+
+std::size_t BundleReader::get_frame_count(std::size_t animation) const noexcept {
+  return animations[animation].frame_count;
+}
+
+Index BundleReader::get_frame_texture(std::size_t animation, std::size_t frame) const noexcept {
+  return expand(frames[animations[animation].first_frame + frame].texture);
+}
+
+std::size_t BundleReader::get_frame_delay(std::size_t animation, std::size_t frame) const noexcept {
+  auto delay_ms = frames[animations[animation].first_frame + frame].delay_ms;
+  return (delay_ms == bundle::endless_delay) ? SIZE_MAX : delay_ms;
+}
+
+std::size_t BundleReader::get_texture_width(std::size_t texture) const noexcept {
+  return textures[texture].width;
+}
+
+std::size_t BundleReader::get_texture_height(std::size_t texture) const noexcept {
+  return textures[texture].height;
+}
+
+const std::uint32_t* BundleReader::get_texture_pixels(std::size_t texture) const noexcept {
+  return (const std::uint32_t*) (base + textures[texture].pixels_offset);
+}
+
+} // namespace herald
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/AnimationTable.h>
+#include <herald/BundleLoader.h>
+#include <herald/BundleReader.h>
+#include <herald/BundleWriter.h>
+#include <herald/HeadlessEngine.h>
+#include <herald/Index.h>
+#include <herald/Model.h>
+#include <herald/ScopedPtr.h>
+#include <herald/TextureTable.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace herald;
+
+namespace {
+
+/// Builds a bundle with two textures, two
+/// animations and three actions.
+std::vector<unsigned char> make_bundle() {
+
+  const std::uint32_t red[2 * 3] = {
+    0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000
+  };
+
+  const std::uint32_t clear[1] = { 0 };
+
+  BundleWriter writer;
+  writer.add_texture(2, 3, red);
+  writer.add_texture(1, 1, clear);
+  writer.add_animation();
+  writer.add_frame(Index(0), 100);
+  writer.add_frame(Index(1), 50);
+  writer.add_animation();
+  writer.add_frame(Index(1), SIZE_MAX);
+  writer.add_action(Index(1));
+  writer.add_action(Index(0));
+  writer.add_action(Index());
+
+  return writer.build();
+}
+
+} // namespace
+
+TEST(Bundle, Read) {
+
+  auto data = make_bundle();
+
+  BundleReader reader;
+
+  ASSERT_TRUE(reader.open(data.data(), data.size()));
+
+  ASSERT_EQ(reader.get_action_count(), 3);
+  EXPECT_EQ(reader.get_action_animation(0), 1);
+  EXPECT_EQ(reader.get_action_animation(1), 0);
+  EXPECT_EQ(reader.get_action_animation(2).valid(), false);
+
+  ASSERT_EQ(reader.get_animation_count(), 2);
+  ASSERT_EQ(reader.get_frame_count(0), 2);
+  ASSERT_EQ(reader.get_frame_count(1), 1);
+  EXPECT_EQ(reader.get_frame_texture(0, 1), 1);
+  EXPECT_EQ(reader.get_frame_delay(0, 1), 50);
+  EXPECT_EQ(reader.get_frame_texture(1, 0), 1);
+  EXPECT_EQ(reader.get_frame_delay(1, 0), SIZE_MAX);
+
+  ASSERT_EQ(reader.get_texture_count(), 2);
+  EXPECT_EQ(reader.get_texture_width(0), 2);
+  EXPECT_EQ(reader.get_texture_height(0), 3);
+  EXPECT_EQ(reader.get_texture_pixels(0)[5], 0xffff0000);
+  EXPECT_EQ(reader.get_texture_pixels(1)[0], 0);
+
+  // The pixels are used in place, so they have to be aligned.
+  const auto* base = (const unsigned char*) data.data();
+  EXPECT_EQ((((const unsigned char*) reader.get_texture_pixels(0)) - base) % 64, 0);
+  EXPECT_EQ((((const unsigned char*) reader.get_texture_pixels(1)) - base) % 64, 0);
+}
+
+TEST(Bundle, Reject) {
+
+  auto data = make_bundle();
+
+  BundleReader reader;
+
+  EXPECT_FALSE(reader.open(data.data(), data.size() - 1));
+  EXPECT_EQ(reader.get_texture_count(), 0);
+
+  auto bad_magic = data;
+  bad_magic[0] = 'X';
+  EXPECT_FALSE(reader.open(bad_magic.data(), bad_magic.size()));
+
+  // The pixels of the second texture are moved out of the bundle.
+  auto bad_texture = data;
+  bad_texture.resize(bad_texture.size() + 64);
+  std::uint64_t file_size = bad_texture.size();
+  std::memcpy(bad_texture.data() + 64, &file_size, sizeof(file_size));
+  EXPECT_TRUE(reader.open(bad_texture.data(), bad_texture.size()));
+  std::uint64_t textures_offset = 0;
+  std::memcpy(&textures_offset, bad_texture.data() + 56, sizeof(textures_offset));
+  std::uint64_t pixels_offset = bad_texture.size();
+  std::memcpy(bad_texture.data() + textures_offset + 16 + 8, &pixels_offset, sizeof(pixels_offset));
+  EXPECT_FALSE(reader.open(bad_texture.data(), bad_texture.size()));
+}
+
+TEST(Bundle, Load) {
+
+  auto data = make_bundle();
+
+  BundleReader reader;
+
+  ASSERT_TRUE(reader.open(data.data(), data.size()));
+
+  auto engine = HeadlessEngine::make();
+
+  auto* model = engine->get_model();
+
+  ASSERT_TRUE(load_bundle_model(model, reader));
+
+  EXPECT_EQ(model->get_texture_table()->size(), 2);
+  EXPECT_EQ(model->get_animation_table()->size(), 2);
+  EXPECT_EQ(model->get_animation_table()->calculate_texture_index(Index(0), 120), 1);
+  ASSERT_EQ(model->get_action_table()->size(), 3);
+  EXPECT_EQ(model->get_action_table()->at(Index(0))->get_animation_index(), 1);
+}
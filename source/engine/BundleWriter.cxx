@@ -0,0 +1,146 @@
+#include <herald/BundleWriter.h>
+
+#include "BundleFormat.h"
+
+#include <cstring>
+
+namespace herald {
+
+namespace {
+
+/// Converts an index to the form stored in a bundle.
+inline std::uint32_t compact(Index index) noexcept {
+  if (index.invalid() || (((std::size_t) index) >= bundle::invalid_index)) {
+    return bundle::invalid_index;
+  } else {
+    return (std::uint32_t) index;
+  }
+}
+
+/// Rounds an offset up to an alignment.
+inline std::size_t align(std::size_t offset, std::size_t alignment) noexcept {
+  return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+/// Copies a table into the bundle.
+/// @param out The bundle being written.
+/// @param offset The location of the table.
+/// @param data The table entries.
+/// @param size The number of bytes in the table.
+void write_table(std::vector<unsigned char>& out,
+                 std::size_t offset,
+                 const void* data,
+                 std::size_t size) {
+  if (size) {
+    std::memcpy(out.data() + offset, data, size);
+  }
+}
+
+} // namespace
+
+void BundleWriter::add_action(Index animation) {
+  actions.emplace_back(compact(animation));
+}
+
+void BundleWriter::add_animation() {
+  animation_starts.emplace_back(frames.size() / 2);
+}
+
+void BundleWriter::add_frame(Index texture, std::size_t delay_ms) {
+
+  if (animation_starts.empty()) {
+    add_animation();
+  }
+
+  frames.emplace_back(compact(texture));
+  frames.emplace_back((delay_ms >= bundle::endless_delay) ? bundle::endless_delay : (std::uint32_t) delay_ms);
+}
+
+void BundleWriter::add_texture(std::size_t width, std::size_t height, const std::uint32_t* pixels) {
+
+  texture_sizes.emplace_back((std::uint32_t) width);
+  texture_sizes.emplace_back((std::uint32_t) height);
+
+  texture_pixels.emplace_back(pixels, pixels + (width * height));
+}
+
+std::vector<unsigned char> BundleWriter::build() const {
+
+  auto frame_count = frames.size() / 2;
+
+  std::vector<BundleAnimation> animation_table;
+
+  for (std::size_t i = 0; i < animation_starts.size(); i++) {
+    auto end = ((i + 1) < animation_starts.size()) ? animation_starts[i + 1] : frame_count;
+    animation_table.emplace_back(BundleAnimation {
+      (std::uint32_t) animation_starts[i],
+      (std::uint32_t) (end - animation_starts[i])
+    });
+  }
+
+  BundleHeader header;
+
+  std::memcpy(header.magic, bundle::magic, sizeof(header.magic));
+
+  header.version = bundle::version;
+  header.byte_order = bundle::byte_order;
+  header.action_count = (std::uint32_t) actions.size();
+  header.animation_count = (std::uint32_t) animation_table.size();
+  header.frame_count = (std::uint32_t) frame_count;
+  header.texture_count = (std::uint32_t) texture_pixels.size();
+
+  auto actions_size = actions.size() * sizeof(std::uint32_t);
+  auto animations_size = animation_table.size() * sizeof(BundleAnimation);
+  auto frames_size = frame_count * sizeof(BundleFrame);
+  auto textures_size = texture_pixels.size() * sizeof(BundleTexture);
+
+  std::size_t offset = align(sizeof(header), bundle::table_alignment);
+
+  header.actions_offset = offset;
+  offset = align(offset + actions_size, bundle::table_alignment);
+
+  header.animations_offset = offset;
+  offset = align(offset + animations_size, bundle::table_alignment);
+
+  header.frames_offset = offset;
+  offset = align(offset + frames_size, bundle::table_alignment);
+
+  header.textures_offset = offset;
+  offset += textures_size;
+
+  std::vector<BundleTexture> texture_table;
+
+  for (std::size_t i = 0; i < texture_pixels.size(); i++) {
+
+    offset = align(offset, bundle::pixel_alignment);
+
+    texture_table.emplace_back(BundleTexture {
+      texture_sizes[(i * 2) + 0],
+      texture_sizes[(i * 2) + 1],
+      offset
+    });
+
+    offset += texture_pixels[i].size() * sizeof(std::uint32_t);
+  }
+
+  header.file_size = offset;
+
+  std::vector<unsigned char> out(offset, 0);
+
+  write_table(out, 0, &header, sizeof(header));
+  write_table(out, header.actions_offset, actions.data(), actions_size);
+  write_table(out, header.animations_offset, animation_table.data(), animations_size);
+  write_table(out, header.frames_offset, frames.data(), frames_size);
+  write_table(out, header.textures_offset, texture_table.data(), textures_size);
+
+  for (std::size_t i = 0; i < texture_pixels.size(); i++) {
+    write_table(out,
+                texture_table[i].pixels_offset,
+                texture_pixels[i].data(),
+                texture_pixels[i].size() * sizeof(std::uint32_t));
+  }
+
+  return out;
+}
+
+} // namespace herald
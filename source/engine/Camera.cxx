@@ -0,0 +1,62 @@
+#include <herald/Camera.h>
+
+#include <cmath>
+
+namespace herald {
+
+namespace {
+
+/// Clips a tile coordinate to a range.
+/// @param value The coordinate to clip.
+/// @param max The number of tiles along the axis.
+/// @returns The clipped coordinate.
+std::size_t clip(double value, std::size_t max) noexcept {
+  if (value <= 0) {
+    return 0;
+  } else if (value >= double(max)) {
+    return max;
+  } else {
+    return std::size_t(value);
+  }
+}
+
+} // namespace
+
+Vec2f Camera::calculate_origin(std::size_t view_w, std::size_t view_h) const noexcept {
+
+  if (fits_room()) {
+    return Vec2f();
+  }
+
+  return Vec2f((position.x() * tile_size) - (view_w / 2.0f),
+               (position.y() * tile_size) - (view_h / 2.0f));
+}
+
+TileRange Camera::calculate_visible_tiles(std::size_t view_w,
+                                          std::size_t view_h,
+                                          std::size_t room_w,
+                                          std::size_t room_h,
+                                          std::size_t margin) const noexcept {
+
+  if (fits_room()) {
+    return TileRange { 0, 0, room_w, room_h };
+  }
+
+  auto origin = calculate_origin(view_w, view_h);
+
+  double size = double(tile_size);
+
+  double left = std::floor(origin.x() / size) - margin;
+  double top = std::floor(origin.y() / size) - margin;
+  double right = std::ceil((origin.x() + view_w) / size) + margin;
+  double bottom = std::ceil((origin.y() + view_h) / size) + margin;
+
+  return TileRange {
+    clip(left, room_w),
+    clip(top, room_h),
+    clip(right, room_w),
+    clip(bottom, room_h)
+  };
+}
+
+} // namespace herald
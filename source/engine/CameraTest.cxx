@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <herald/Camera.h>
+#include <herald/Vec2f.h>
+
+using namespace herald;
+
+TEST(Camera, FitsRoom) {
+
+  Camera camera;
+
+  auto range = camera.calculate_visible_tiles(640, 480, 20, 10, 2);
+
+  EXPECT_EQ(range, (TileRange { 0, 0, 20, 10 }));
+  EXPECT_EQ(camera.calculate_origin(640, 480).x(), 0);
+}
+
+TEST(Camera, VisibleTiles) {
+
+  Camera camera;
+  camera.set_tile_size(32);
+  camera.set_position(Vec2f(100, 50));
+
+  // 640x480 is 20x15 tiles, centered on (100, 50).
+  auto origin = camera.calculate_origin(640, 480);
+  EXPECT_EQ(origin.x(), 3200 - 320);
+  EXPECT_EQ(origin.y(), 1600 - 240);
+
+  auto range = camera.calculate_visible_tiles(640, 480, 1000, 1000, 1);
+  EXPECT_EQ(range, (TileRange { 89, 41, 111, 59 }));
+  EXPECT_EQ(range.size(), 22 * 18);
+  EXPECT_EQ(range.contains(89, 41), true);
+  EXPECT_EQ(range.contains(111, 41), false);
+
+  // Clipped to the room.
+  camera.set_position(Vec2f(0, 0));
+  range = camera.calculate_visible_tiles(640, 480, 1000, 1000, 1);
+  EXPECT_EQ(range, (TileRange { 0, 0, 11, 9 }));
+
+  // Entirely outside of the room.
+  camera.set_position(Vec2f(-100, -100));
+  range = camera.calculate_visible_tiles(640, 480, 1000, 1000, 1);
+  EXPECT_EQ(range.size(), 0);
+}
@@ -0,0 +1,38 @@
+#include <herald/FixedStepClock.h>
+
+namespace herald {
+
+FixedStepClock::FixedStepClock(std::size_t step_ms_, std::size_t max_steps_) noexcept
+  : step_ms(step_ms_ ? step_ms_ : 1),
+    max_steps(max_steps_),
+    pending_ms(0),
+    ellapsed_ms(0),
+    dropped_ms(0) {}
+
+std::size_t FixedStepClock::advance(std::size_t delta_ms) noexcept {
+
+  pending_ms += delta_ms;
+
+  auto steps = pending_ms / step_ms;
+
+  if (max_steps && (steps > max_steps)) {
+    auto dropped_steps = steps - max_steps;
+    dropped_ms += dropped_steps * step_ms;
+    pending_ms -= dropped_steps * step_ms;
+    steps = max_steps;
+  }
+
+  pending_ms -= steps * step_ms;
+
+  ellapsed_ms += steps * step_ms;
+
+  return steps;
+}
+
+void FixedStepClock::reset() noexcept {
+  pending_ms = 0;
+  ellapsed_ms = 0;
+  dropped_ms = 0;
+}
+
+} // namespace herald
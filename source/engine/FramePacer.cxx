@@ -0,0 +1,55 @@
+#include <herald/FramePacer.h>
+
+namespace herald {
+
+namespace {
+
+/// Converts a frame rate to the length of one step.
+/// @param frame_rate The number of frames per second.
+/// @returns The length of one frame, in milliseconds.
+std::size_t to_step_ms(std::size_t frame_rate) noexcept {
+  return frame_rate ? (1000 / frame_rate) : 1000;
+}
+
+} // namespace
+
+FramePacer::FramePacer(std::size_t frame_rate, std::size_t max_catch_up) noexcept
+  : clock(to_step_ms(frame_rate), max_catch_up),
+    last_frame_ns(0),
+    remainder_ns(0),
+    started(false) {}
+
+void FramePacer::set_frame_rate(std::size_t frame_rate, std::size_t max_catch_up) noexcept {
+  clock = FixedStepClock(to_step_ms(frame_rate), max_catch_up);
+  remainder_ns = 0;
+  stats.reset();
+}
+
+void FramePacer::start(std::uint64_t now_ns) noexcept {
+  last_frame_ns = now_ns;
+  started = true;
+}
+
+std::size_t FramePacer::tick(std::uint64_t now_ns) noexcept {
+
+  if (!started || (now_ns < last_frame_ns)) {
+    start(now_ns);
+    return 0;
+  }
+
+  auto frame_ns = now_ns - last_frame_ns;
+
+  last_frame_ns = now_ns;
+
+  stats.record(frame_ns, clock.get_step_ms() * 1000000);
+
+  remainder_ns += frame_ns;
+
+  auto delta_ms = remainder_ns / 1000000;
+
+  remainder_ns -= delta_ms * 1000000;
+
+  return clock.advance((std::size_t) delta_ms);
+}
+
+} // namespace herald
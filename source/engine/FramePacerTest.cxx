@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <herald/FixedStepClock.h>
+#include <herald/FramePacer.h>
+#include <herald/FrameStats.h>
+
+using namespace herald;
+
+TEST(FrameStats, Record) {
+
+  FrameStats stats;
+
+  EXPECT_EQ(stats.get_min_ns(), 0);
+  EXPECT_EQ(stats.get_mean_ns(), 0);
+
+  stats.record(10, 10);
+  stats.record(20, 10);
+  stats.record(15, 10);
+
+  EXPECT_EQ(stats.get_frame_count(), 3);
+  EXPECT_EQ(stats.get_late_count(), 1);
+  EXPECT_EQ(stats.get_min_ns(), 10);
+  EXPECT_EQ(stats.get_max_ns(), 20);
+  EXPECT_EQ(stats.get_last_ns(), 15);
+  EXPECT_EQ(stats.get_mean_ns(), 15);
+}
+
+TEST(FramePacer, KeepsSubMillisecondTime) {
+
+  FramePacer pacer(100);
+
+  EXPECT_EQ(pacer.get_step_ms(), 10);
+
+  pacer.start(0);
+
+  // Each frame runs a bit late, which
+  // adds up to an extra step over time.
+  std::size_t steps = 0;
+
+  for (std::uint64_t i = 1; i <= 100; i++) {
+    steps += pacer.tick(i * 10100000);
+  }
+
+  EXPECT_EQ(steps, 101);
+  EXPECT_EQ(pacer.get_clock().get_ellapsed_ms(), 1010);
+  EXPECT_EQ(pacer.get_stats().get_frame_count(), 100);
+}
+
+TEST(FramePacer, LimitsCatchUp) {
+
+  FramePacer pacer(100, 3);
+
+  pacer.start(1000000000);
+
+  EXPECT_EQ(pacer.tick(1500000000), 3);
+  EXPECT_EQ(pacer.get_clock().get_dropped_ms(), 470);
+  EXPECT_EQ(pacer.get_stats().get_late_count(), 1);
+
+  // A pause isn't caught up on.
+  pacer.start(9000000000);
+  EXPECT_EQ(pacer.tick(9010000000), 1);
+}
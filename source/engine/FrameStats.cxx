@@ -0,0 +1,39 @@
+#include <herald/FrameStats.h>
+
+namespace herald {
+
+FrameStats::FrameStats() noexcept {
+  reset();
+}
+
+void FrameStats::record(std::uint64_t frame_ns, std::uint64_t budget_ns) noexcept {
+
+  frame_count++;
+
+  total_ns += frame_ns;
+
+  if (frame_ns < min_ns) {
+    min_ns = frame_ns;
+  }
+
+  if (frame_ns > max_ns) {
+    max_ns = frame_ns;
+  }
+
+  if (frame_ns > (budget_ns + (budget_ns / 2))) {
+    late_count++;
+  }
+
+  last_ns = frame_ns;
+}
+
+void FrameStats::reset() noexcept {
+  frame_count = 0;
+  late_count = 0;
+  total_ns = 0;
+  min_ns = UINT64_MAX;
+  max_ns = 0;
+  last_ns = 0;
+}
+
+} // namespace herald
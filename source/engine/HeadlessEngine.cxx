@@ -0,0 +1,60 @@
+#include <herald/HeadlessEngine.h>
+
+#include <herald/FixedStepClock.h>
+#include <herald/ScopedPtr.h>
+
+#include "HeadlessModel.h"
+
+namespace herald {
+
+namespace {
+
+/// An implementation of the headless engine.
+class HeadlessEngineImpl final : public HeadlessEngine {
+  /// The data model being simulated.
+  ScopedPtr<HeadlessModel> model;
+  /// Turns real time into simulation steps.
+  FixedStepClock clock;
+  /// The number of steps taken so far.
+  std::size_t step_count;
+public:
+  /// Constructs an instance of the headless engine.
+  /// @param step_ms The length of one simulation step.
+  /// @param max_steps The most steps to take per call to @ref advance.
+  HeadlessEngineImpl(std::size_t step_ms, std::size_t max_steps)
+    : model(HeadlessModel::make()),
+      clock(step_ms, max_steps),
+      step_count(0) {}
+  /// Moves the game forward in time,
+  /// taking as many steps as the time adds up to.
+  void advance(std::size_t delta_ms) override {
+    step(clock.advance(delta_ms));
+  }
+  /// Accesses a pointer to the model.
+  Model* get_model() override {
+    return model.get();
+  }
+  /// Takes a number of simulation steps.
+  void step(std::size_t count) override {
+    for (std::size_t i = 0; i < count; i++) {
+      model->advance(clock.get_step_ms());
+    }
+    step_count += count;
+  }
+  /// Accesses the clock driving the simulation.
+  const FixedStepClock& get_clock() const noexcept override {
+    return clock;
+  }
+  /// Accesses the number of steps taken so far.
+  std::size_t get_step_count() const noexcept override {
+    return step_count;
+  }
+};
+
+} // namespace
+
+ScopedPtr<HeadlessEngine> HeadlessEngine::make(std::size_t step_ms, std::size_t max_steps) {
+  return new HeadlessEngineImpl(step_ms, max_steps);
+}
+
+} // namespace herald
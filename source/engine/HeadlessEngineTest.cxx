@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/FixedStepClock.h>
+#include <herald/HeadlessEngine.h>
+#include <herald/Index.h>
+#include <herald/Model.h>
+#include <herald/ObjectTable.h>
+#include <herald/Room.h>
+#include <herald/ScopedPtr.h>
+#include <herald/TextureTable.h>
+
+#include "HeadlessModel.h"
+#include "HeadlessObjectTable.h"
+#include "HeadlessRoom.h"
+
+using namespace herald;
+
+namespace {
+
+/// Adds an animation that alternates
+/// between two textures every 100ms.
+void add_blinking_animation(Model& model) {
+  auto animation = Animation::make();
+  animation->add_frame(Index(0), 100);
+  animation->add_frame(Index(1), 100);
+  model.get_animation_table()->add(std::move(animation));
+}
+
+} // namespace
+
+TEST(FixedStepClock, CarriesRemainder) {
+
+  FixedStepClock clock(10);
+
+  EXPECT_EQ(clock.advance(25), 2);
+  EXPECT_EQ(clock.get_pending_ms(), 5);
+  EXPECT_EQ(clock.advance(5), 1);
+  EXPECT_EQ(clock.get_pending_ms(), 0);
+  EXPECT_EQ(clock.advance(9), 0);
+  EXPECT_EQ(clock.get_ellapsed_ms(), 30);
+}
+
+TEST(FixedStepClock, DropsExcessSteps) {
+
+  FixedStepClock clock(10, 4);
+
+  EXPECT_EQ(clock.advance(105), 4);
+  EXPECT_EQ(clock.get_pending_ms(), 5);
+  EXPECT_EQ(clock.get_dropped_ms(), 60);
+  EXPECT_EQ(clock.get_ellapsed_ms(), 40);
+}
+
+TEST(HeadlessEngine, Advance) {
+
+  auto engine = HeadlessEngine::make(10);
+
+  engine->advance(35);
+
+  EXPECT_EQ(engine->get_step_count(), 3);
+  EXPECT_EQ(engine->get_clock().get_pending_ms(), 5);
+
+  engine->step(2);
+
+  EXPECT_EQ(engine->get_step_count(), 5);
+}
+
+TEST(HeadlessEngine, Model) {
+
+  auto engine = HeadlessEngine::make();
+
+  auto* model = engine->get_model();
+  ASSERT_NE(model, nullptr);
+
+  model->get_texture_table()->open("texture_01.png");
+  EXPECT_EQ(model->get_texture_table()->size(), 1);
+
+  model->get_room()->resize(4, 3);
+  EXPECT_EQ(model->get_room()->width(), 4);
+  EXPECT_EQ(model->get_room()->height(), 3);
+
+  model->get_object_table()->resize(2);
+  EXPECT_EQ(model->get_object_table()->size(), 2);
+
+  engine->advance(1000);
+
+  EXPECT_NE(model->get_background(), nullptr);
+}
+
+TEST(HeadlessModel, Animate) {
+
+  auto model = HeadlessModel::make();
+
+  add_blinking_animation(*model);
+
+  model->get_action_table()->add(Action(Index(0)));
+
+  const int indices[] = { 0, -1 };
+
+  model->get_room()->resize(2, 1);
+  model->get_room()->assign_animation_indices(indices, 2);
+
+  model->get_object_table()->resize(1);
+  model->get_object_table()->set_action_index(Index(0), Index(0));
+
+  const auto& room = model->get_headless_room();
+  const auto& objects = model->get_headless_object_table();
+
+  model->advance(50);
+
+  EXPECT_EQ(model->get_ellapsed_ms(), 50);
+  EXPECT_EQ(room.get_texture_index(0, 0), 0);
+  EXPECT_EQ(room.get_texture_index(1, 0).valid(), false);
+  EXPECT_EQ(objects.get_texture_index(0), 0);
+
+  model->advance(100);
+
+  EXPECT_EQ(room.get_texture_index(0, 0), 1);
+  EXPECT_EQ(objects.get_texture_index(0), 1);
+
+  EXPECT_EQ(room.get_texture_index(2, 0).valid(), false);
+  EXPECT_EQ(objects.get_texture_index(1).valid(), false);
+}
@@ -0,0 +1,131 @@
+#include "HeadlessModel.h"
+
+#include <herald/ActionTable.h>
+#include <herald/AnimationTable.h>
+#include <herald/Background.h>
+#include <herald/Camera.h>
+#include <herald/ScopedPtr.h>
+#include <herald/TextureTable.h>
+
+#include "HeadlessObjectTable.h"
+#include "HeadlessRoom.h"
+
+#include <string>
+#include <vector>
+
+namespace herald {
+
+namespace {
+
+/// A texture table that only keeps the paths of
+/// the textures, since nothing is ever displayed.
+/// Textures opened from pixels have an empty path.
+class HeadlessTextureTable final : public TextureTable {
+  /// The paths of the opened textures.
+  std::vector<std::string> paths;
+public:
+  /// Adds a texture to the table, without reading it.
+  /// @param filename The path to the texture.
+  void open(const char* filename) override {
+    paths.emplace_back(filename);
+  }
+  /// Adds a texture to the table, without using the pixels.
+  void open_pixels(const std::uint32_t*, std::size_t, std::size_t) override {
+    paths.emplace_back();
+  }
+  /// Indicates the number of textures in the table.
+  std::size_t size() const noexcept override {
+    return paths.size();
+  }
+};
+
+/// Implements the headless model interface.
+class HeadlessModelImpl final : public HeadlessModel {
+  /// The action table for the model.
+  ScopedPtr<ActionTable> actions;
+  /// The animation table for the model.
+  ScopedPtr<AnimationTable> animations;
+  /// The textures for the model.
+  ScopedPtr<HeadlessTextureTable> textures;
+  /// The background of the model.
+  ScopedPtr<Background> background;
+  /// The camera of the model. There is no view
+  /// to cull, so this is only kept for the game.
+  Camera camera;
+  /// The room for the model.
+  ScopedPtr<HeadlessRoom> room;
+  /// The objects within the model.
+  ScopedPtr<HeadlessObjectTable> object_table;
+  /// The total number of ellapsed milliseconds.
+  std::size_t ellapsed_ms;
+public:
+  /// Constructs a new headless model instance.
+  HeadlessModelImpl()
+    : actions(ActionTable::make()),
+      animations(AnimationTable::make()),
+      textures(new HeadlessTextureTable()),
+      background(new Background()),
+      room(HeadlessRoom::make()),
+      object_table(HeadlessObjectTable::make()),
+      ellapsed_ms(0) {}
+  /// Moves the model forward in time.
+  /// @param delta_ms The value to increase the timeline by.
+  void advance(std::size_t delta_ms) override {
+
+    ellapsed_ms += delta_ms;
+
+    room->update_texture_indices(ellapsed_ms, *animations);
+
+    object_table->update_animation_indices(*actions);
+    object_table->update_texture_indices(ellapsed_ms, *animations);
+  }
+  /// Accesses the total number of ellapsed milliseconds.
+  std::size_t get_ellapsed_ms() const noexcept override {
+    return ellapsed_ms;
+  }
+  /// Accesses a pointer to the action table.
+  ActionTable* get_action_table() override {
+    return actions.get();
+  }
+  /// Accesses a pointer to the animation table.
+  AnimationTable* get_animation_table() override {
+    return animations.get();
+  }
+  /// Accesses a pointer to the background.
+  Background* get_background() override {
+    return background.get();
+  }
+  /// Accesses a pointer to the camera.
+  Camera* get_camera() override {
+    return &camera;
+  }
+  /// Accesses a pointer to the object map.
+  ObjectTable* get_object_table() override {
+    return object_table.get();
+  }
+  /// Accesses the room.
+  /// @returns A pointer to the model's room.
+  Room* get_room() override {
+    return room.get();
+  }
+  /// Accesses a pointer to the texture table.
+  TextureTable* get_texture_table() override {
+    return textures.get();
+  }
+  /// Accesses the headless room.
+  const HeadlessRoom& get_headless_room() const noexcept override {
+    return *room;
+  }
+  /// Accesses the headless object table.
+  const HeadlessObjectTable& get_headless_object_table() const noexcept override {
+    return *object_table;
+  }
+};
+
+} // namespace
+
+ScopedPtr<HeadlessModel> HeadlessModel::make() {
+  return new HeadlessModelImpl();
+}
+
+} // namespace herald
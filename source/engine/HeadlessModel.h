@@ -0,0 +1,32 @@
+#pragma once
+
+#include <herald/Model.h>
+
+#include <cstddef>
+
+namespace herald {
+
+class HeadlessObjectTable;
+class HeadlessRoom;
+
+/// A model that keeps the state of the game
+/// without any of the objects needed to display it.
+class HeadlessModel : public Model {
+public:
+  /// Creates a new instance of the headless model.
+  static ScopedPtr<HeadlessModel> make();
+  /// Just a stub.
+  virtual ~HeadlessModel() {}
+  /// Moves the items in the model forward
+  /// in time, by a certain number of milliseconds.
+  /// @param delta_ms The number of milliseconds to move forward by.
+  virtual void advance(std::size_t delta_ms) = 0;
+  /// Accesses the total number of ellapsed milliseconds.
+  virtual std::size_t get_ellapsed_ms() const noexcept = 0;
+  /// Accesses the headless room of the model.
+  virtual const HeadlessRoom& get_headless_room() const noexcept = 0;
+  /// Accesses the headless object table of the model.
+  virtual const HeadlessObjectTable& get_headless_object_table() const noexcept = 0;
+};
+
+} // namespace herald
@@ -0,0 +1,55 @@
+#include "HeadlessObjectTable.h"
+
+#include <herald/Index.h>
+#include <herald/ObjectStore.h>
+#include <herald/ScopedPtr.h>
+
+namespace herald {
+
+namespace {
+
+/// The implementation of the headless object table.
+class HeadlessObjectTableImpl final : public HeadlessObjectTable {
+  /// The state of the objects in the table.
+  ObjectStore store;
+public:
+  /// Translates an object.
+  void translate(Index index, const Vec2f& delta_pos) override {
+    store.translate(index, delta_pos);
+  }
+  /// Sets the action of an object.
+  void set_action_index(Index index, Index action_index) override {
+    store.set_action_index(index, action_index);
+  }
+  /// Accesses the texture index of an object.
+  Index get_texture_index(Index index) const noexcept override {
+    return store.get_texture_index(index);
+  }
+  /// Resizes the number of objects in the table.
+  /// @param count The number of objects to keep in the table.
+  void resize(std::size_t count) override {
+    store.resize(count);
+  }
+  /// Indicates the number of objects in the table.
+  std::size_t size() const noexcept override {
+    return store.size();
+  }
+  /// Updates the animation indices of the objects.
+  void update_animation_indices(const ActionTable& actions) override {
+    store.update_animation_indices(actions);
+  }
+  /// Updates the texture indices assigned to each of the objects.
+  /// There is nothing to apply the changes to, so they're dropped.
+  void update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) override {
+    store.update_texture_indices(ellapsed_ms, animations);
+    store.clear_changes();
+  }
+};
+
+} // namespace
+
+ScopedPtr<HeadlessObjectTable> HeadlessObjectTable::make() {
+  return new HeadlessObjectTableImpl();
+}
+
+} // namespace herald
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <herald/ObjectTable.h>
+
+#include <cstddef>
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+class AnimationTable;
+class Index;
+
+/// An object table that only keeps track of
+/// the state of the objects, without displaying them.
+class HeadlessObjectTable : public ObjectTable {
+public:
+  /// Creates a new headless object table.
+  /// @returns A new headless object table instance.
+  static ScopedPtr<HeadlessObjectTable> make();
+  /// Just a stub.
+  virtual ~HeadlessObjectTable() {}
+  /// Accesses the texture index of an object.
+  /// @param index The index of the object.
+  /// @returns The texture index of the object. If the index
+  /// is out of bounds, then an invalid index is returned.
+  virtual Index get_texture_index(Index index) const noexcept = 0;
+  /// Updates the texture indices for the objects.
+  /// @param ellapsed_ms The total number of ellapsed milliseconds during game play.
+  /// @param animations The animation table to get the texture indices from.
+  virtual void update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
+};
+
+} // namespace herald
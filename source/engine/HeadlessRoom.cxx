@@ -0,0 +1,133 @@
+#include "HeadlessRoom.h"
+
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/ScopedPtr.h>
+
+#include "TileScheduler.h"
+
+#include <vector>
+
+namespace herald {
+
+namespace {
+
+/// A tile that keeps its texture
+/// index instead of rendering it.
+class HeadlessTile final : public Tile {
+  /// The index of the texture the tile would display.
+  Index texture_index;
+public:
+  using Tile::get_animation_index;
+  /// Accesses the texture index of the tile.
+  inline Index get_texture_index() const noexcept {
+    return texture_index;
+  }
+  /// Updates the texture index of the tile.
+  /// @param ellapsed_ms The updated timeline duration.
+  /// @param animations The animation table to get the texture index from.
+  /// @returns True if the texture index changed, false otherwise.
+  bool update_texture_index(std::size_t ellapsed_ms, const AnimationTable& animations) {
+
+    auto next_texture_index = animations.calculate_texture_index(get_animation_index(), ellapsed_ms);
+
+    auto changed = texture_index != next_texture_index;
+
+    texture_index = next_texture_index;
+
+    return changed;
+  }
+};
+
+/// The implementation of the headless room.
+class HeadlessRoomImpl final : public HeadlessRoom {
+  /// The tiles of the room, row by row.
+  std::vector<HeadlessTile> tiles;
+  /// Decides which tiles are updated as time passes.
+  ScopedPtr<TileScheduler> scheduler;
+  /// Whether or not a tile was handed out by @ref at,
+  /// in which case its animation may have been changed
+  /// without the scheduler knowing about it.
+  bool tiles_exposed;
+public:
+  /// Constructs an empty room.
+  HeadlessRoomImpl() : scheduler(TileScheduler::make()), tiles_exposed(false) {}
+  /// Accesses a tile at a specific coordinate.
+  Tile* at(std::size_t x, std::size_t y) override {
+    if ((x < width()) && (y < height())) {
+      tiles_exposed = true;
+      return &tiles[(y * width()) + x];
+    } else {
+      return Tile::get_null_tile();
+    }
+  }
+  /// Assigns the animation indices of the tiles.
+  /// @param indices The animation indices, row by row.
+  /// @param count The number of animation indices.
+  void assign_animation_indices(const int* indices, std::size_t count) override {
+
+    auto tile_count = tiles.size();
+
+    for (std::size_t i = 0; (i < count) && (i < tile_count); i++) {
+      tiles[i].set_animation_index((std::size_t) indices[i]);
+      scheduler->assign(i, tiles[i].get_animation_index());
+    }
+  }
+  /// Accesses the texture index of a tile.
+  Index get_texture_index(std::size_t x, std::size_t y) const noexcept override {
+    if ((x < width()) && (y < height())) {
+      return tiles[(y * width()) + x].get_texture_index();
+    } else {
+      return Index();
+    }
+  }
+  /// Resizes the number of tiles in the room.
+  /// @param w The width to assign the room.
+  /// @param h The height to assign the room.
+  void resize(std::size_t w, std::size_t h) override {
+
+    tiles.resize(w * h);
+
+    Room::resize(w, h);
+
+    scheduler->resize(tiles.size());
+
+    sync_scheduler();
+  }
+  /// Updates the texture indices of the
+  /// tiles that the scheduler wakes up.
+  std::size_t update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) override {
+
+    if (tiles_exposed) {
+      sync_scheduler();
+      tiles_exposed = false;
+    }
+
+    auto woken_count = scheduler->advance(ellapsed_ms, animations);
+
+    const auto* woken = scheduler->get_woken_tiles();
+
+    std::size_t changed = 0;
+
+    for (std::size_t i = 0; i < woken_count; i++) {
+      changed += tiles[woken[i]].update_texture_index(ellapsed_ms, animations) ? 1 : 0;
+    }
+
+    return changed;
+  }
+protected:
+  /// Passes the animation of every tile to the scheduler.
+  void sync_scheduler() {
+    for (std::size_t i = 0; i < tiles.size(); i++) {
+      scheduler->assign(i, tiles[i].get_animation_index());
+    }
+  }
+};
+
+} // namespace
+
+ScopedPtr<HeadlessRoom> HeadlessRoom::make() {
+  return new HeadlessRoomImpl();
+}
+
+} // namespace herald
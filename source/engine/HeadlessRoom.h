@@ -0,0 +1,37 @@
+#pragma once
+
+#include <herald/Room.h>
+
+#include <cstddef>
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+class AnimationTable;
+class Index;
+
+/// A room that only keeps track of the
+/// animation and texture index of each tile.
+class HeadlessRoom : public Room {
+public:
+  /// Creates a new headless room.
+  /// @returns A new headless room instance.
+  static ScopedPtr<HeadlessRoom> make();
+  /// Just a stub.
+  virtual ~HeadlessRoom() {}
+  /// Accesses the texture index of a tile.
+  /// @param x The X coordinate of the tile.
+  /// @param y The Y coordinate of the tile.
+  /// @returns The texture index of the tile. If the
+  /// coordinates are out of bounds, an invalid index is returned.
+  virtual Index get_texture_index(std::size_t x, std::size_t y) const noexcept = 0;
+  /// Updates the texture indices used for each tile in the room.
+  /// @param ellapsed_ms The updated number of ellapsed milliseconds.
+  /// @param animations A reference to the animation table.
+  /// @returns The number of tiles whose texture index changed.
+  virtual std::size_t update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
+};
+
+} // namespace herald
@@ -1,11 +1,23 @@
 #include <herald/JsonModel.h>
 
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
+#include <herald/TextureTable.h>
 
+#include "HeadlessModel.h"
 #include "Json.h"
 
+#include <cstdint>
 #include <fstream>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace herald {
 
@@ -13,56 +25,372 @@ namespace {
 
 using Json = nlohmann::json;
 
+/// The top level sections of a JSON model.
+enum class Section {
+  /// A section that isn't part of the model.
+  None,
+  /// The "actions" array.
+  Actions,
+  /// The "animations" array.
+  Animations,
+  /// The "textures" array.
+  Textures
+};
+
+/// The fields that a value may be assigned to.
+enum class Field {
+  /// A value that isn't part of the model.
+  None,
+  /// The "animation" field of an action.
+  Animation,
+  /// The "texture" field of a frame.
+  Texture,
+  /// The "delay" field of a frame.
+  Delay,
+  /// The "path" field of a texture.
+  Path
+};
+
+/// A frame of the animation being read.
+struct Frame final {
+  /// The texture displayed by the frame.
+  Index texture;
+  /// The number of milliseconds the frame lasts.
+  std::size_t delay_ms;
+};
+
+/// Receives the events of the JSON parser and puts
+/// the model data straight into the model's tables,
+/// so that the document is never kept in memory.
+///
+/// The model has this layout:
+///
+///   - "actions" is an array of objects, each
+///     with the index of an "animation".
+///   - "animations" is an array of arrays, each frame
+///     being an object with a "texture" and a "delay".
+///   - "textures" is an array of paths, or of objects
+///     with a "path" field.
+///
+/// Anything else in the document is skipped.
+class ModelReader final {
+  /// The model to put the data into.
+  Model& model;
+  /// The directory that texture paths are relative to.
+  std::string base_path;
+  /// The number of objects and arrays that are open.
+  std::size_t depth;
+  /// The section being read.
+  Section section;
+  /// The field that the next value is assigned to.
+  Field field;
+  /// The animation of the action being read.
+  Index action_animation;
+  /// The frame being read.
+  Frame frame;
+  /// The frames of the animation being read. This is reused
+  /// for every animation, so that each one is made with the
+  /// exact number of frames it needs.
+  std::vector<Frame> frames;
+  /// The path of the texture being read.
+  std::string texture_path;
+public:
+  /// Constructs the model reader.
+  /// @param m The model to put the data into.
+  /// @param base The directory that texture paths are relative to.
+  ModelReader(Model& m, const std::string& base)
+    : model(m),
+      base_path(base),
+      depth(0),
+      section(Section::None),
+      field(Field::None),
+      frame(Frame { Index(), SIZE_MAX }) {}
+  /// Handles a null value.
+  bool null() {
+    field = Field::None;
+    return true;
+  }
+  /// Handles a boolean value.
+  bool boolean(bool) {
+    field = Field::None;
+    return true;
+  }
+  /// Handles a negative or signed integer.
+  bool number_integer(Json::number_integer_t value) {
+    if (value < 0) {
+      assign_index(Index());
+      return true;
+    }
+    return number_unsigned((Json::number_unsigned_t) value);
+  }
+  /// Handles an unsigned integer.
+  bool number_unsigned(Json::number_unsigned_t value) {
+    if (field == Field::Delay) {
+      frame.delay_ms = (value > SIZE_MAX) ? SIZE_MAX : (std::size_t) value;
+      field = Field::None;
+    } else {
+      assign_index((value >= SIZE_MAX) ? Index() : Index((std::size_t) value));
+    }
+    return true;
+  }
+  /// Handles a floating point number.
+  /// These are truncated, like in the directory loader.
+  bool number_float(Json::number_float_t value, const std::string&) {
+    if (value < 0) {
+      return number_integer(-1);
+    } else {
+      return number_unsigned((Json::number_unsigned_t) value);
+    }
+  }
+  /// Handles a string value.
+  bool string(std::string& value) {
+
+    if ((section == Section::Textures) && (depth == 2)) {
+      open_texture(value);
+    } else if (field == Field::Path) {
+      texture_path = std::move(value);
+    }
+
+    field = Field::None;
+
+    return true;
+  }
+  /// Handles binary data, which isn't part of JSON text.
+  template <typename Binary>
+  bool binary(Binary&) {
+    field = Field::None;
+    return true;
+  }
+  /// Handles the start of an object.
+  bool start_object(std::size_t) {
+
+    field = Field::None;
+
+    depth++;
+
+    if ((section == Section::Textures) && (depth == 3)) {
+      texture_path.clear();
+    }
+
+    return true;
+  }
+  /// Handles an object key.
+  bool key(std::string& name) {
+
+    field = Field::None;
+
+    if (depth == 1) {
+      section = to_section(name);
+    } else if ((section == Section::Actions) && (depth == 3)) {
+      field = (name == "animation") ? Field::Animation : Field::None;
+    } else if ((section == Section::Animations) && (depth == 4)) {
+      if (name == "texture") {
+        field = Field::Texture;
+      } else if (name == "delay") {
+        field = Field::Delay;
+      }
+    } else if ((section == Section::Textures) && (depth == 3)) {
+      field = (name == "path") ? Field::Path : Field::None;
+    }
+
+    return true;
+  }
+  /// Handles the end of an object.
+  bool end_object() {
+
+    if ((section == Section::Actions) && (depth == 3)) {
+      model.get_action_table()->add(Action(action_animation));
+      action_animation = Index();
+    } else if ((section == Section::Animations) && (depth == 4)) {
+      frames.emplace_back(frame);
+      frame = Frame { Index(), SIZE_MAX };
+    } else if ((section == Section::Textures) && (depth == 3)) {
+      if (!texture_path.empty()) {
+        open_texture(texture_path);
+      }
+    }
+
+    return end_container();
+  }
+  /// Handles the start of an array.
+  bool start_array(std::size_t) {
+
+    field = Field::None;
+
+    depth++;
+
+    if ((section == Section::Animations) && (depth == 3)) {
+      frames.clear();
+    }
+
+    return true;
+  }
+  /// Handles the end of an array.
+  bool end_array() {
+
+    if ((section == Section::Animations) && (depth == 3)) {
+
+      auto animation = Animation::make();
+
+      animation->reserve(frames.size());
+
+      for (const auto& f : frames) {
+        animation->add_frame(f.texture, f.delay_ms);
+      }
+
+      model.get_animation_table()->add(std::move(animation));
+    }
+
+    return end_container();
+  }
+  /// Handles a syntax error, which stops the parser.
+  template <typename Exception>
+  bool parse_error(std::size_t, const std::string&, const Exception&) {
+    return false;
+  }
+protected:
+  /// Assigns an index to the current field.
+  void assign_index(Index index) {
+
+    if (field == Field::Animation) {
+      action_animation = index;
+    } else if (field == Field::Texture) {
+      frame.texture = index;
+    } else if (field == Field::Delay) {
+      frame.delay_ms = 0;
+    }
+
+    field = Field::None;
+  }
+  /// Closes an object or array.
+  bool end_container() {
+
+    field = Field::None;
+
+    depth--;
+
+    if (depth <= 1) {
+      section = Section::None;
+    }
+
+    return true;
+  }
+  /// Adds a texture to the model's texture table.
+  /// @param path The path of the texture, which is
+  /// relative to @ref base_path unless it's absolute.
+  void open_texture(const std::string& path) {
+    if (base_path.empty() || (!path.empty() && (path[0] == '/'))) {
+      model.get_texture_table()->open(path.c_str());
+    } else {
+      model.get_texture_table()->open((base_path + "/" + path).c_str());
+    }
+  }
+  /// Gets the section that a key at the top of the model refers to.
+  static Section to_section(const std::string& name) {
+    if (name == "actions") {
+      return Section::Actions;
+    } else if (name == "animations") {
+      return Section::Animations;
+    } else if (name == "textures") {
+      return Section::Textures;
+    } else {
+      return Section::None;
+    }
+  }
+};
+
 /// The implementation of the JSON model.
+/// The tables are the same as the headless model's,
+/// so that the model can be simulated once it's read.
 class JsonModelImpl final : public JsonModel {
-  /// The JSON instance containing the model data.
-  Json json;
+  /// The model that the data is read into.
+  ScopedPtr<HeadlessModel> model;
 public:
+  /// Constructs an empty JSON model.
+  JsonModelImpl() : model(HeadlessModel::make()) {}
   /// Reads a JSON model from a stream.
   /// @param input The stream to read the model from.
-  JsonModelImpl(std::istream& input) {
-    input >> json;
+  /// @param base_path The directory that texture paths are relative to.
+  /// @returns True on success, false if the stream doesn't contain valid JSON.
+  bool read(std::istream& input, const std::string& base_path) {
+
+    ProfileScope scope("JsonModel::read");
+
+    ModelReader reader(*model, base_path);
+
+    return Json::sax_parse(input, &reader);
   }
   /// Accesses a pointer to the animation table.
   AnimationTable* get_animation_table() override {
-    return nullptr;
+    return model->get_animation_table();
   }
   /// Accesses a pointer to the action table.
   ActionTable* get_action_table() override {
-    return nullptr;
+    return model->get_action_table();
   }
   /// Accesses a pointer to the background instance.
   Background* get_background() override {
-    return nullptr;
+    return model->get_background();
+  }
+  /// Accesses a pointer to the camera.
+  Camera* get_camera() override {
+    return model->get_camera();
   }
   /// Accesses a pointer to the object map;
   ObjectTable* get_object_table() override {
-    return nullptr;
+    return model->get_object_table();
   }
   /// Accesses a pointer to the model's room.
   Room* get_room() override {
-    return nullptr;
+    return model->get_room();
   }
   /// Accesses a pointer to the texture table.
   TextureTable* get_texture_table() override {
-    return nullptr;
+    return model->get_texture_table();
   }
 };
 
+/// Gets the directory of a file path.
+/// @param filename The path of the file.
+/// @returns The directory part of the path,
+/// which is empty if there isn't one.
+std::string get_directory(const std::string& filename) {
+
+  auto pos = filename.find_last_of("/\\");
+
+  return (pos == std::string::npos) ? std::string() : filename.substr(0, pos);
+}
+
 } // namespace
 
 ScopedPtr<JsonModel> JsonModel::open(const char* filename) {
 
   std::ifstream file(filename);
 
-  return new JsonModelImpl(file);
+  if (!file) {
+    return nullptr;
+  }
+
+  ScopedPtr<JsonModelImpl> model(new JsonModelImpl());
+
+  if (!model->read(file, get_directory(filename))) {
+    return nullptr;
+  }
+
+  return model.release();
 }
 
 ScopedPtr<JsonModel> JsonModel::from_source(const char* source) {
 
   std::istringstream stream(source);
 
-  return new JsonModelImpl(stream);
+  ScopedPtr<JsonModelImpl> model(new JsonModelImpl());
+
+  if (!model->read(stream, std::string())) {
+    return nullptr;
+  }
+
+  return model.release();
 }
 
 } // namespace herald
@@ -1,12 +1,21 @@
 #include <gtest/gtest.h>
 
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
 #include <herald/JsonModel.h>
 #include <herald/ScopedPtr.h>
+#include <herald/TextureTable.h>
+
+using namespace herald;
 
 namespace {
 
 const char* source = R"(
 {
+  "title" : { "actions" : [ { "animation" : 9 } ] },
   "textures" : [
     {
       "path" : "texture_01.png",
@@ -15,7 +24,22 @@ const char* source = R"(
     {
       "path" : "texture_02.png",
       "name" : "Texture 2"
-    }
+    },
+    "texture_03.png"
+  ],
+  "animations" : [
+    [
+      { "texture" : 0, "delay" : 100 },
+      { "texture" : 1, "delay" : 50 }
+    ],
+    [
+      { "texture" : 2 }
+    ]
+  ],
+  "actions" : [
+    { "animation" : 1 },
+    { "animation" : 0, "name" : "Walk" },
+    { }
   ]
 }
 )";
@@ -24,9 +48,28 @@ const char* source = R"(
 
 TEST(JsonModel, Read) {
 
-  auto model = herald::JsonModel::from_source(source);
+  auto model = JsonModel::from_source(source);
   ASSERT_EQ(model, true);
 
   auto* texture_table = model->get_texture_table();
   ASSERT_EQ(!!texture_table, true);
+  EXPECT_EQ(texture_table->size(), 3);
+
+  auto* animations = model->get_animation_table();
+  ASSERT_EQ(animations->size(), 2);
+  EXPECT_EQ(animations->at(Index(0))->get_frame_count(), 2);
+  EXPECT_EQ(animations->at(Index(0))->get_frame_texture(1), 1);
+  EXPECT_EQ(animations->calculate_texture_index(Index(0), 120), 1);
+  EXPECT_EQ(animations->at(Index(1))->get_frame_texture(0), 2);
+  EXPECT_EQ(animations->at(Index(1))->calculate_next_change(0), SIZE_MAX);
+
+  auto* actions = model->get_action_table();
+  ASSERT_EQ(actions->size(), 3);
+  EXPECT_EQ(actions->at(Index(0))->get_animation_index(), 1);
+  EXPECT_EQ(actions->at(Index(1))->get_animation_index(), 0);
+  EXPECT_EQ(actions->at(Index(2))->get_animation_index().valid(), false);
+}
+
+TEST(JsonModel, Invalid) {
+  EXPECT_EQ(JsonModel::from_source("{ \"actions\" : [ "), false);
 }
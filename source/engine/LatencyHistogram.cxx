@@ -0,0 +1,140 @@
+#include <herald/LatencyHistogram.h>
+
+#include <ostream>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace herald {
+
+namespace {
+
+/// The number of bits that select a sub-bucket
+/// within a power of two.
+const unsigned int sub_bucket_bits = 5;
+
+/// The number of buckets needed to count any 64-bit value.
+/// The largest value has its highest bit at 63, which is
+/// shifted down by 58 to leave six bits.
+const std::size_t bucket_count = ((64 - sub_bucket_bits - 1) << sub_bucket_bits) + (2 << sub_bucket_bits);
+
+/// Finds the index of the highest set bit.
+/// @param value The value to search. This must not be zero.
+inline unsigned int highest_bit(std::uint64_t value) noexcept {
+#ifdef _MSC_VER
+  unsigned long index = 0;
+  _BitScanReverse64(&index, value);
+  return (unsigned int) index;
+#else
+  return 63 - (unsigned int) __builtin_clzll(value);
+#endif
+}
+
+} // namespace
+
+const std::size_t LatencyHistogram::sub_bucket_count = std::size_t(1) << sub_bucket_bits;
+
+const std::uint64_t LatencyHistogram::linear_limit = std::uint64_t(2) << sub_bucket_bits;
+
+LatencyHistogram::LatencyHistogram()
+  : counts(bucket_count, 0),
+    total_count(0),
+    min_ns(0),
+    max_ns(0) {}
+
+void LatencyHistogram::record(std::uint64_t latency_ns) noexcept {
+
+  counts[to_bucket(latency_ns)]++;
+
+  if (!total_count || (latency_ns < min_ns)) {
+    min_ns = latency_ns;
+  }
+
+  if (latency_ns > max_ns) {
+    max_ns = latency_ns;
+  }
+
+  total_count++;
+}
+
+void LatencyHistogram::reset() noexcept {
+
+  for (auto& count : counts) {
+    count = 0;
+  }
+
+  total_count = 0;
+  min_ns = 0;
+  max_ns = 0;
+}
+
+std::uint64_t LatencyHistogram::get_percentile(double percentile) const noexcept {
+
+  if (!total_count) {
+    return 0;
+  }
+
+  if (percentile > 100.0) {
+    percentile = 100.0;
+  }
+
+  // The rank of the value at the percentile, counting from one.
+  auto rank = (std::uint64_t) ((percentile / 100.0) * (double) total_count + 0.5);
+
+  if (rank < 1) {
+    rank = 1;
+  } else if (rank > total_count) {
+    rank = total_count;
+  }
+
+  std::uint64_t seen = 0;
+
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    seen += counts[i];
+    if (seen >= rank) {
+      auto value = to_highest_value(i);
+      return (value < max_ns) ? value : max_ns;
+    }
+  }
+
+  return max_ns;
+}
+
+void LatencyHistogram::write_json(std::ostream& output) const {
+  output << "{\"count\":" << total_count
+         << ",\"min_ns\":" << get_min_ns()
+         << ",\"p50_ns\":" << get_percentile(50.0)
+         << ",\"p99_ns\":" << get_percentile(99.0)
+         << ",\"p999_ns\":" << get_percentile(99.9)
+         << ",\"max_ns\":" << max_ns
+         << '}';
+}
+
+std::size_t LatencyHistogram::to_bucket(std::uint64_t value) noexcept {
+
+  if (value < linear_limit) {
+    return (std::size_t) value;
+  }
+
+  // Keep the highest six bits of the value. The top one is
+  // always set, so the other five pick the sub-bucket.
+  auto shift = highest_bit(value) - sub_bucket_bits;
+
+  return (std::size_t) ((std::uint64_t(shift) << sub_bucket_bits) + (value >> shift));
+}
+
+std::uint64_t LatencyHistogram::to_highest_value(std::size_t bucket) noexcept {
+
+  if (bucket < linear_limit) {
+    return bucket;
+  }
+
+  auto shift = (unsigned int) ((bucket >> sub_bucket_bits) - 1);
+
+  auto top = std::uint64_t((bucket & (sub_bucket_count - 1)) + sub_bucket_count);
+
+  return (top << shift) + ((std::uint64_t(1) << shift) - 1);
+}
+
+} // namespace herald
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <herald/LatencyHistogram.h>
+#include <herald/LatencyTable.h>
+
+#include <sstream>
+#include <string>
+
+using namespace herald;
+
+TEST(LatencyHistogram, Buckets) {
+
+  // Small values are exact.
+  for (std::uint64_t v = 0; v < LatencyHistogram::linear_limit; v++) {
+    EXPECT_EQ(LatencyHistogram::to_bucket(v), v);
+    EXPECT_EQ(LatencyHistogram::to_highest_value(v), v);
+  }
+
+  // Larger values land in a bucket whose range contains them
+  // and is no wider than a thirty-second of the value.
+  std::uint64_t values[] = { 64, 65, 127, 128, 1000, 123456789, 1ull << 40, ~0ull };
+
+  for (auto v : values) {
+    auto bucket = LatencyHistogram::to_bucket(v);
+    auto highest = LatencyHistogram::to_highest_value(bucket);
+    auto lowest = LatencyHistogram::to_highest_value(bucket - 1) + 1;
+    EXPECT_LE(lowest, v);
+    EXPECT_GE(highest, v);
+    EXPECT_LE(highest - lowest, v / LatencyHistogram::sub_bucket_count);
+  }
+}
+
+TEST(LatencyHistogram, Percentiles) {
+
+  LatencyHistogram histogram;
+
+  EXPECT_EQ(histogram.get_percentile(50.0), 0);
+
+  // One thousand latencies of 1..1000 microseconds.
+  for (std::uint64_t i = 1; i <= 1000; i++) {
+    histogram.record(i * 1000);
+  }
+
+  EXPECT_EQ(histogram.get_count(), 1000);
+  EXPECT_EQ(histogram.get_min_ns(), 1000);
+  EXPECT_EQ(histogram.get_max_ns(), 1000000);
+
+  auto p50 = histogram.get_percentile(50.0);
+  auto p99 = histogram.get_percentile(99.0);
+  auto p999 = histogram.get_percentile(99.9);
+
+  EXPECT_GE(p50, 500000);
+  EXPECT_LE(p50, 500000 + 500000 / 32);
+  EXPECT_GE(p99, 990000);
+  EXPECT_LE(p99, 1000000);
+  EXPECT_GE(p999, 999000);
+  EXPECT_LE(p999, 1000000);
+  EXPECT_EQ(histogram.get_percentile(100.0), 1000000);
+
+  histogram.reset();
+
+  EXPECT_EQ(histogram.get_count(), 0);
+  EXPECT_EQ(histogram.get_max_ns(), 0);
+}
+
+TEST(LatencyTable, Json) {
+
+  LatencyTable table;
+
+  table.record("build_room", 2000);
+  table.record("update_axis", 10);
+  table.record("update_axis", 30);
+
+  ASSERT_EQ(table.get_name_count(), 2);
+  EXPECT_EQ(std::string(table.get_name(0)), "build_room");
+  EXPECT_EQ(table.find("update_axis")->get_count(), 2);
+  EXPECT_EQ(table.find("exit"), nullptr);
+  EXPECT_EQ(table.get_last_ns(), 30);
+
+  std::ostringstream stream;
+
+  table.write_json(stream);
+
+  EXPECT_EQ(stream.str(),
+            "{\n"
+            "\"build_room\":{\"count\":1,\"min_ns\":2000,\"p50_ns\":2000,\"p99_ns\":2000,\"p999_ns\":2000,\"max_ns\":2000},\n"
+            "\"update_axis\":{\"count\":2,\"min_ns\":10,\"p50_ns\":10,\"p99_ns\":30,\"p999_ns\":30,\"max_ns\":30}\n"
+            "}\n");
+}
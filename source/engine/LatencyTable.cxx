@@ -0,0 +1,71 @@
+#include <herald/LatencyTable.h>
+
+#include <cstring>
+#include <ostream>
+
+namespace herald {
+
+void LatencyTable::record(const char* name, std::uint64_t latency_ns) {
+
+  last_ns = latency_ns;
+
+  for (auto& entry : entries) {
+    if (std::strcmp(entry.name.c_str(), name) == 0) {
+      entry.histogram.record(latency_ns);
+      return;
+    }
+  }
+
+  entries.emplace_back(Entry { name, LatencyHistogram() });
+
+  entries.back().histogram.record(latency_ns);
+}
+
+void LatencyTable::reset() noexcept {
+
+  for (auto& entry : entries) {
+    entry.histogram.reset();
+  }
+
+  last_ns = 0;
+}
+
+const LatencyHistogram* LatencyTable::find(const char* name) const noexcept {
+
+  for (const auto& entry : entries) {
+    if (std::strcmp(entry.name.c_str(), name) == 0) {
+      return &entry.histogram;
+    }
+  }
+
+  return nullptr;
+}
+
+void LatencyTable::write_json(std::ostream& output) const {
+
+  output << '{';
+
+  for (std::size_t i = 0; i < entries.size(); i++) {
+
+    output << ((i == 0) ? "\n" : ",\n");
+
+    // Command names are identifiers, but the quotes
+    // and backslashes are escaped just in case.
+    output << '"';
+
+    for (auto c : entries[i].name) {
+      if ((c == '"') || (c == '\\')) {
+        output << '\\';
+      }
+      output << c;
+    }
+
+    output << "\":";
+
+    entries[i].histogram.write_json(output);
+  }
+
+  output << "\n}\n";
+}
+
+} // namespace herald
@@ -0,0 +1,54 @@
+#include <herald/Model.h>
+
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/Room.h>
+#include <herald/TextureTable.h>
+#include <herald/Tile.h>
+
+#include <vector>
+
+namespace herald {
+
+void Model::prefetch_room_textures() {
+
+  auto* room = get_room();
+  auto* animations = get_animation_table();
+  auto* textures = get_texture_table();
+
+  // Rooms are mostly made of a few animations,
+  // so each one is only visited once.
+  std::vector<bool> visited(animations->size(), false);
+
+  for (std::size_t y = 0; y < room->height(); y++) {
+
+    for (std::size_t x = 0; x < room->width(); x++) {
+
+      auto animation_index = room->at(x, y)->get_animation_index();
+
+      if ((animation_index >= visited.size()) || visited[animation_index]) {
+        continue;
+      }
+
+      visited[animation_index] = true;
+
+      const auto* animation = animations->at(animation_index);
+
+      for (std::size_t i = 0; i < animation->get_frame_count(); i++) {
+        textures->prefetch(animation->get_frame_texture(i));
+      }
+    }
+  }
+}
+
+void Model::prefetch_all_textures() {
+
+  auto* textures = get_texture_table();
+
+  for (std::size_t i = 0; i < textures->size(); i++) {
+    textures->prefetch(Index(i));
+  }
+}
+
+} // namespace herald
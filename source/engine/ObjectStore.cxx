@@ -0,0 +1,245 @@
+#include <herald/ObjectStore.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/AnimationTable.h>
+#include <herald/Camera.h>
+
+#include <algorithm>
+
+namespace herald {
+
+namespace {
+
+/// Converts an index to its 32-bit form.
+/// @param index The index to convert.
+/// @returns The 32-bit index, which is invalid if
+/// the index is invalid or doesn't fit.
+inline std::uint32_t compact(Index index) noexcept {
+  if (index.invalid() || (((std::size_t) index) >= ObjectStore::invalid_index)) {
+    return ObjectStore::invalid_index;
+  } else {
+    return (std::uint32_t) index;
+  }
+}
+
+/// Converts a 32-bit index back to a regular index.
+/// @param index The 32-bit index to convert.
+/// @returns The equivalent regular index.
+inline Index expand(std::uint32_t index) noexcept {
+  if (index == ObjectStore::invalid_index) {
+    return Index();
+  } else {
+    return Index(index);
+  }
+}
+
+} // namespace
+
+const std::uint32_t ObjectStore::invalid_index = 0xffffffff;
+
+ObjectStore::ObjectStore() noexcept : changed_begin(0), changed_end(0) {}
+
+void ObjectStore::resize(std::size_t count) {
+
+  auto prev_count = size();
+
+  x_values.resize(count, 0.0f);
+  y_values.resize(count, 0.0f);
+  action_indices.resize(count, invalid_index);
+  animation_indices.resize(count, invalid_index);
+  texture_indices.resize(count, invalid_index);
+  changes.resize(count, 0xf);
+
+  changed_begin = std::min(changed_begin, count);
+  changed_end = std::min(changed_end, count);
+
+  if (count > prev_count) {
+
+    if (changed_begin == changed_end) {
+      changed_begin = prev_count;
+    }
+
+    changed_end = count;
+  }
+}
+
+void ObjectStore::translate(Index index, const Vec2f& delta_pos) noexcept {
+
+  if (index >= size()) {
+    return;
+  }
+
+  x_values[index] += delta_pos.x();
+  y_values[index] += delta_pos.y();
+
+  mark_changed(index, ObjectChange::Position);
+}
+
+void ObjectStore::set_action_index(Index index, Index action_index) noexcept {
+
+  if (index >= size()) {
+    return;
+  }
+
+  auto next_action_index = compact(action_index);
+
+  if (action_indices[index] != next_action_index) {
+    action_indices[index] = next_action_index;
+    mark_changed(index, ObjectChange::Action);
+  }
+}
+
+void ObjectStore::mark_all_changed(ObjectChange change) noexcept {
+
+  for (auto& c : changes) {
+    c |= (std::uint8_t) change;
+  }
+
+  changed_begin = 0;
+  changed_end = size();
+}
+
+void ObjectStore::mark_changed_between(const TileRange& prev,
+                                       const TileRange& next,
+                                       ObjectChange change) noexcept {
+
+  auto count = size();
+
+  for (std::size_t i = 0; i < count; i++) {
+    Vec2f pos(x_values[i], y_values[i]);
+    if (prev.overlaps(pos) != next.overlaps(pos)) {
+      changes[i] |= (std::uint8_t) change;
+    }
+  }
+
+  extend_changed_range();
+}
+
+void ObjectStore::update_animation_indices(const ActionTable& actions) {
+
+  auto action_count = std::min(actions.size(), (std::size_t) invalid_index);
+
+  action_animations.resize(action_count + 1);
+
+  for (std::size_t i = 0; i < action_count; i++) {
+    action_animations[i] = compact(actions.at(i)->get_animation_index());
+  }
+
+  action_animations[action_count] = invalid_index;
+
+  const auto* lookup = action_animations.data();
+  const auto* src = action_indices.data();
+  auto* dst = animation_indices.data();
+  auto last = (std::uint32_t) action_count;
+  auto count = size();
+
+  for (std::size_t i = 0; i < count; i++) {
+    dst[i] = lookup[std::min(src[i], last)];
+  }
+}
+
+void ObjectStore::update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) {
+
+  auto animation_count = std::min(animations.size(), (std::size_t) invalid_index);
+
+  animation_textures.resize(animation_count + 1);
+
+  for (std::size_t i = 0; i < animation_count; i++) {
+    animation_textures[i] = compact(animations.calculate_texture_index(i, ellapsed_ms));
+  }
+
+  animation_textures[animation_count] = invalid_index;
+
+  const auto* lookup = animation_textures.data();
+  const auto* src = animation_indices.data();
+  auto* dst = texture_indices.data();
+  auto* flags = changes.data();
+  auto last = (std::uint32_t) animation_count;
+  auto flag = (std::uint8_t) ObjectChange::Texture;
+  auto count = size();
+
+  for (std::size_t i = 0; i < count; i++) {
+    auto next = lookup[std::min(src[i], last)];
+    flags[i] |= (std::uint8_t) ((dst[i] != next) * flag);
+    dst[i] = next;
+  }
+
+  extend_changed_range();
+}
+
+Vec2f ObjectStore::get_position(Index index) const noexcept {
+  if (index >= size()) {
+    return Vec2f();
+  } else {
+    return Vec2f(x_values[index], y_values[index]);
+  }
+}
+
+Index ObjectStore::get_action_index(Index index) const noexcept {
+  return (index < size()) ? expand(action_indices[index]) : Index();
+}
+
+Index ObjectStore::get_animation_index(Index index) const noexcept {
+  return (index < size()) ? expand(animation_indices[index]) : Index();
+}
+
+Index ObjectStore::get_texture_index(Index index) const noexcept {
+  return (index < size()) ? expand(texture_indices[index]) : Index();
+}
+
+void ObjectStore::clear_changes() noexcept {
+
+  std::fill(changes.begin() + changed_begin,
+            changes.begin() + changed_end,
+            0);
+
+  changed_begin = 0;
+  changed_end = 0;
+}
+
+void ObjectStore::mark_changed(std::size_t index, ObjectChange change) noexcept {
+
+  changes[index] |= (std::uint8_t) change;
+
+  if (changed_begin == changed_end) {
+    changed_begin = index;
+    changed_end = index + 1;
+  } else {
+    changed_begin = std::min(changed_begin, index);
+    changed_end = std::max(changed_end, index + 1);
+  }
+}
+
+void ObjectStore::extend_changed_range() noexcept {
+
+  auto count = size();
+
+  // When nothing was marked yet, the whole store is outside of the range.
+  auto empty = (changed_begin == changed_end);
+
+  auto front_end = empty ? count : changed_begin;
+
+  std::size_t first = 0;
+
+  while ((first < front_end) && !changes[first]) {
+    first++;
+  }
+
+  if (first == count) {
+    return;
+  }
+
+  auto back_begin = empty ? (first + 1) : changed_end;
+
+  std::size_t last = count;
+
+  while ((last > back_begin) && !changes[last - 1]) {
+    last--;
+  }
+
+  changed_begin = first;
+  changed_end = last;
+}
+
+} // namespace herald
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/ObjectStore.h>
+#include <herald/ScopedPtr.h>
+#include <herald/Vec2f.h>
+
+using namespace herald;
+
+namespace {
+
+/// The number of actions and animations in the benchmark tables.
+const std::size_t action_count = 16;
+
+/// Fills the action and animation tables. Each
+/// animation has a different frame length, so that
+/// the objects change textures at different times.
+void fill_tables(ActionTable& actions, AnimationTable& animations) {
+  for (std::size_t i = 0; i < action_count; i++) {
+
+    auto animation = Animation::make();
+    animation->add_frame(Index(i * 2), 50 + i * 10);
+    animation->add_frame(Index(i * 2 + 1), 50 + i * 10);
+    animations.add(std::move(animation));
+
+    actions.add(Action(Index(i)));
+  }
+}
+
+/// Runs the per-frame passes over an object store, with
+/// every object animating and a few of them moving.
+void BM_ObjectStoreFrame(benchmark::State& state) {
+
+  auto actions = ActionTable::make();
+  auto animations = AnimationTable::make();
+
+  fill_tables(*actions, *animations);
+
+  auto count = (std::size_t) state.range(0);
+
+  ObjectStore store;
+  store.resize(count);
+
+  for (std::size_t i = 0; i < count; i++) {
+    store.set_action_index(i, Index((i * 7) % action_count));
+  }
+
+  store.clear_changes();
+
+  std::size_t ellapsed_ms = 0;
+
+  for (auto _ : state) {
+
+    ellapsed_ms += 16;
+
+    store.translate(ellapsed_ms % count, Vec2f(1, 0));
+
+    store.update_animation_indices(*actions);
+
+    store.update_texture_indices(ellapsed_ms, *animations);
+
+    benchmark::DoNotOptimize(store.get_changed_end());
+
+    store.clear_changes();
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+} // namespace
+
+BENCHMARK(BM_ObjectStoreFrame)->Arg(10000)->Arg(100000);
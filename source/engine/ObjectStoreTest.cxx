@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <herald/Action.h>
+#include <herald/ActionTable.h>
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Camera.h>
+#include <herald/Index.h>
+#include <herald/ObjectStore.h>
+#include <herald/ScopedPtr.h>
+#include <herald/Vec2f.h>
+
+using namespace herald;
+
+namespace {
+
+/// Adds an animation that alternates
+/// between textures 3 and 4 every 100ms.
+void add_blinking_animation(AnimationTable& animations) {
+  auto animation = Animation::make();
+  animation->add_frame(Index(3), 100);
+  animation->add_frame(Index(4), 100);
+  animations.add(std::move(animation));
+}
+
+} // namespace
+
+TEST(ObjectStore, Changes) {
+
+  ObjectStore store;
+
+  store.resize(4);
+
+  EXPECT_EQ(store.get_changed_begin(), 0);
+  EXPECT_EQ(store.get_changed_end(), 4);
+  EXPECT_EQ(store.has_change(0, ObjectChange::Position), true);
+  EXPECT_EQ(store.has_change(3, ObjectChange::Size), true);
+
+  store.clear_changes();
+
+  EXPECT_EQ(store.get_changed_begin(), store.get_changed_end());
+  EXPECT_EQ(store.has_changes(0), false);
+
+  store.translate(2, Vec2f(1, 2));
+  store.set_action_index(1, Index(0));
+
+  EXPECT_EQ(store.get_changed_begin(), 1);
+  EXPECT_EQ(store.get_changed_end(), 3);
+  EXPECT_EQ(store.has_change(1, ObjectChange::Action), true);
+  EXPECT_EQ(store.has_change(2, ObjectChange::Position), true);
+  EXPECT_EQ(store.get_position(2).x(), 1);
+  EXPECT_EQ(store.get_position(2).y(), 2);
+
+  store.clear_changes();
+
+  // Same action again.
+  store.set_action_index(1, Index(0));
+  EXPECT_EQ(store.has_changes(1), false);
+
+  // Out of bounds.
+  store.translate(4, Vec2f(1, 1));
+  store.set_action_index(4, Index(0));
+  EXPECT_EQ(store.get_changed_begin(), store.get_changed_end());
+  EXPECT_EQ(store.get_position(4).x(), 0);
+  EXPECT_EQ(store.get_action_index(4).valid(), false);
+
+  store.resize(6);
+
+  EXPECT_EQ(store.get_changed_begin(), 4);
+  EXPECT_EQ(store.get_changed_end(), 6);
+}
+
+TEST(ObjectStore, ChangedBetween) {
+
+  ObjectStore store;
+
+  store.resize(4);
+
+  // Stays in view, leaves it, comes into it and stays out of it.
+  store.translate(0, Vec2f(2, 2));
+  store.translate(1, Vec2f(0.5f, 1));
+  store.translate(2, Vec2f(5, 3));
+  store.translate(3, Vec2f(20, 20));
+
+  store.clear_changes();
+
+  TileRange prev { 0, 0, 4, 4 };
+  TileRange next { 2, 0, 6, 4 };
+
+  store.mark_changed_between(prev, next, ObjectChange::Position);
+
+  EXPECT_EQ(store.has_changes(0), false);
+  EXPECT_EQ(store.has_change(1, ObjectChange::Position), true);
+  EXPECT_EQ(store.has_change(2, ObjectChange::Position), true);
+  EXPECT_EQ(store.has_changes(3), false);
+  EXPECT_EQ(store.get_changed_begin(), 1);
+  EXPECT_EQ(store.get_changed_end(), 3);
+
+  store.clear_changes();
+
+  store.mark_changed_between(next, next, ObjectChange::Position);
+
+  EXPECT_EQ(store.get_changed_begin(), store.get_changed_end());
+}
+
+TEST(ObjectStore, UpdateIndices) {
+
+  auto actions = ActionTable::make();
+  actions->add(Action(Index(0)));
+
+  auto animations = AnimationTable::make();
+  add_blinking_animation(*animations);
+
+  ObjectStore store;
+  store.resize(8);
+  store.set_action_index(2, Index(0));
+  store.set_action_index(5, Index(0));
+  // Not in the action table.
+  store.set_action_index(6, Index(1));
+  store.clear_changes();
+
+  store.update_animation_indices(*actions);
+
+  EXPECT_EQ(store.get_animation_index(2), 0);
+  EXPECT_EQ(store.get_animation_index(5), 0);
+  EXPECT_EQ(store.get_animation_index(6).valid(), false);
+  EXPECT_EQ(store.get_animation_index(0).valid(), false);
+
+  store.update_texture_indices(10, *animations);
+
+  EXPECT_EQ(store.get_texture_index(2), 3);
+  EXPECT_EQ(store.get_texture_index(5), 3);
+  EXPECT_EQ(store.get_texture_index(6).valid(), false);
+  EXPECT_EQ(store.get_changed_begin(), 2);
+  EXPECT_EQ(store.get_changed_end(), 6);
+  EXPECT_EQ(store.has_change(2, ObjectChange::Texture), true);
+  EXPECT_EQ(store.has_changes(3), false);
+
+  store.clear_changes();
+
+  store.update_texture_indices(50, *animations);
+  EXPECT_EQ(store.get_changed_begin(), store.get_changed_end());
+
+  store.translate(3, Vec2f(1, 0));
+  store.update_texture_indices(100, *animations);
+
+  EXPECT_EQ(store.get_texture_index(2), 4);
+  EXPECT_EQ(store.get_changed_begin(), 2);
+  EXPECT_EQ(store.get_changed_end(), 6);
+
+  store.clear_changes();
+
+  // Going back in time.
+  store.update_texture_indices(0, *animations);
+  EXPECT_EQ(store.get_texture_index(5), 3);
+
+  // The action table gets the missing action.
+  actions->add(Action(Index(0)));
+  store.update_animation_indices(*actions);
+  store.update_texture_indices(0, *animations);
+  EXPECT_EQ(store.get_texture_index(6), 3);
+}
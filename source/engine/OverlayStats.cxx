@@ -0,0 +1,55 @@
+#include <herald/OverlayStats.h>
+
+namespace herald {
+
+const std::size_t OverlayStats::history_size = 120;
+
+OverlayStats::OverlayStats()
+  : frame_times(history_size, 0),
+    next(0),
+    count(0),
+    total_ns(0),
+    queue_depth(0),
+    last_rtt_ns(0),
+    texture_bytes(0),
+    texture_budget(0) {}
+
+void OverlayStats::record_frame(std::uint64_t frame_ns) noexcept {
+
+  // Once the ring is full, the frame time being
+  // replaced is the oldest one, and leaves the sum.
+  total_ns -= frame_times[next];
+  total_ns += frame_ns;
+
+  frame_times[next] = frame_ns;
+
+  next = (next + 1) % history_size;
+
+  if (count < history_size) {
+    count++;
+  }
+}
+
+std::uint64_t OverlayStats::get_frame_ns(std::size_t index) const noexcept {
+  return frame_times[(next + history_size - count + index) % history_size];
+}
+
+std::uint64_t OverlayStats::get_max_frame_ns() const noexcept {
+
+  std::uint64_t max_ns = 0;
+
+  for (std::size_t i = 0; i < count; i++) {
+    auto frame_ns = get_frame_ns(i);
+    if (frame_ns > max_ns) {
+      max_ns = frame_ns;
+    }
+  }
+
+  return max_ns;
+}
+
+double OverlayStats::get_fps() const noexcept {
+  return total_ns ? (((double) count) * 1000000000.0 / ((double) total_ns)) : 0.0;
+}
+
+} // namespace herald
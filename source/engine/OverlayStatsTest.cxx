@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <herald/OverlayStats.h>
+
+using namespace herald;
+
+TEST(OverlayStats, FrameHistory) {
+
+  OverlayStats stats;
+
+  EXPECT_EQ(stats.get_frame_count(), 0);
+  EXPECT_EQ(stats.get_fps(), 0.0);
+
+  stats.record_frame(10000000);
+  stats.record_frame(30000000);
+
+  EXPECT_EQ(stats.get_frame_count(), 2);
+  EXPECT_EQ(stats.get_frame_ns(0), 10000000);
+  EXPECT_EQ(stats.get_frame_ns(1), 30000000);
+  EXPECT_EQ(stats.get_max_frame_ns(), 30000000);
+  EXPECT_DOUBLE_EQ(stats.get_fps(), 50.0);
+
+  // Filling the ring pushes out the oldest frames,
+  // along with their share of the frame rate.
+  for (std::size_t i = 0; i < OverlayStats::history_size; i++) {
+    stats.record_frame(20000000);
+  }
+
+  EXPECT_EQ(stats.get_frame_count(), OverlayStats::history_size);
+  EXPECT_EQ(stats.get_frame_ns(0), 20000000);
+  EXPECT_EQ(stats.get_max_frame_ns(), 20000000);
+  EXPECT_DOUBLE_EQ(stats.get_fps(), 50.0);
+}
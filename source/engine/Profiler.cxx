@@ -0,0 +1,270 @@
+#include <herald/Profiler.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace herald {
+
+namespace {
+
+/// The events recorded by one thread.
+struct ThreadBuffer final {
+  /// Guards the events while they're exported.
+  /// This is never contended during a frame, since
+  /// only the owning thread records into the buffer.
+  std::mutex mutex;
+  /// The ring of events.
+  std::vector<ProfileEvent> events;
+  /// Where the next event goes.
+  std::size_t next;
+  /// The number of events in the ring.
+  std::size_t count;
+  /// The ID of the thread in the trace.
+  std::size_t thread_id;
+  /// Whether or not a thread is recording into the buffer.
+  /// This is guarded by the mutex of the registry.
+  bool in_use;
+  /// Constructs an empty thread buffer.
+  /// @param id The ID of the thread in the trace.
+  ThreadBuffer(std::size_t id)
+    : events(Profiler::buffer_capacity), next(0), count(0), thread_id(id), in_use(true) {}
+};
+
+/// Keeps the buffers of every thread that recorded an event.
+struct Registry final {
+  /// Guards the list of buffers.
+  std::mutex mutex;
+  /// The buffer of each thread.
+  std::vector<ScopedPtr<ThreadBuffer>> buffers;
+  /// The ID to give the next thread in the trace.
+  std::size_t next_thread_id = 1;
+};
+
+/// Accesses the registry of thread buffers.
+Registry& get_registry() {
+  static Registry registry;
+  return registry;
+}
+
+/// Finds a buffer for the calling thread. The buffer of a
+/// thread that exited is reused before a new one is made,
+/// so that thread pools which replace their threads don't
+/// keep adding buffers.
+/// @returns The buffer for the thread to record into.
+ThreadBuffer* acquire_thread_buffer() {
+
+  auto& registry = get_registry();
+
+  std::lock_guard<std::mutex> registry_lock(registry.mutex);
+
+  auto thread_id = registry.next_thread_id++;
+
+  for (auto& buffer : registry.buffers) {
+
+    if (buffer->in_use) {
+      continue;
+    }
+
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+
+    // The events of the exited thread are dropped,
+    // rather than appearing under the new thread's ID.
+    buffer->next = 0;
+    buffer->count = 0;
+    buffer->thread_id = thread_id;
+    buffer->in_use = true;
+
+    return buffer.get();
+  }
+
+  registry.buffers.emplace_back(new ThreadBuffer(thread_id));
+
+  return registry.buffers.back().get();
+}
+
+/// Holds the buffer of a thread, and gives it
+/// back to the registry when the thread exits.
+struct ThreadBufferOwner final {
+  /// The buffer of the thread, or null
+  /// if the thread hasn't recorded anything.
+  ThreadBuffer* buffer = nullptr;
+  /// Marks the buffer as free to reuse.
+  /// The events in it are kept until then.
+  ~ThreadBufferOwner() {
+    if (buffer) {
+      auto& registry = get_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      buffer->in_use = false;
+    }
+  }
+};
+
+/// Accesses the calling thread's buffer,
+/// acquiring one the first time.
+ThreadBuffer& get_thread_buffer() {
+
+  thread_local ThreadBufferOwner owner;
+
+  if (!owner.buffer) {
+    owner.buffer = acquire_thread_buffer();
+  }
+
+  return *owner.buffer;
+}
+
+/// Writes a time in microseconds, which is the unit
+/// of a Chrome trace, keeping the nanoseconds.
+/// @param output The stream to write to.
+/// @param ns The time to write, in nanoseconds.
+void write_microseconds(std::ostream& output, std::uint64_t ns) {
+
+  auto fraction = ns % 1000;
+
+  output << (ns / 1000) << '.'
+         << (char) ('0' + (fraction / 100))
+         << (char) ('0' + ((fraction / 10) % 10))
+         << (char) ('0' + (fraction % 10));
+}
+
+/// Writes a string as a JSON string.
+/// @param output The stream to write to.
+/// @param str The string to write.
+void write_string(std::ostream& output, const char* str) {
+
+  output << '"';
+
+  for (; *str; str++) {
+    if ((*str == '"') || (*str == '\\')) {
+      output << '\\' << *str;
+    } else if (((unsigned char) *str) < 0x20) {
+      output << ' ';
+    } else {
+      output << *str;
+    }
+  }
+
+  output << '"';
+}
+
+} // namespace
+
+std::atomic<bool> Profiler::enabled(false);
+
+const std::size_t Profiler::buffer_capacity = 16384;
+
+void Profiler::set_enabled(bool state) noexcept {
+  enabled.store(state, std::memory_order_relaxed);
+}
+
+bool Profiler::enabled_by_environment() noexcept {
+
+  const auto* value = std::getenv("HERALD_PROFILE");
+
+  return value && (value[0] != 0) && !((value[0] == '0') && (value[1] == 0));
+}
+
+std::uint64_t Profiler::now_ns() noexcept {
+
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+  return (std::uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+void Profiler::record(const char* name, std::uint64_t start_ns, std::uint64_t end_ns) {
+
+  auto& buffer = get_thread_buffer();
+
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+
+  buffer.events[buffer.next] = ProfileEvent { name, start_ns, (end_ns > start_ns) ? (end_ns - start_ns) : 0 };
+
+  buffer.next = (buffer.next + 1) % buffer_capacity;
+
+  if (buffer.count < buffer_capacity) {
+    buffer.count++;
+  }
+}
+
+void Profiler::clear() {
+
+  auto& registry = get_registry();
+
+  std::lock_guard<std::mutex> registry_lock(registry.mutex);
+
+  for (auto& buffer : registry.buffers) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->next = 0;
+    buffer->count = 0;
+  }
+}
+
+std::size_t Profiler::get_buffer_count() {
+
+  auto& registry = get_registry();
+
+  std::lock_guard<std::mutex> registry_lock(registry.mutex);
+
+  return registry.buffers.size();
+}
+
+std::size_t Profiler::get_event_count() {
+
+  auto& registry = get_registry();
+
+  std::lock_guard<std::mutex> registry_lock(registry.mutex);
+
+  std::size_t count = 0;
+
+  for (auto& buffer : registry.buffers) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    count += buffer->count;
+  }
+
+  return count;
+}
+
+void Profiler::write_chrome_trace(std::ostream& output) {
+
+  auto& registry = get_registry();
+
+  std::lock_guard<std::mutex> registry_lock(registry.mutex);
+
+  output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  auto first = true;
+
+  for (auto& buffer : registry.buffers) {
+
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+
+    // The oldest event is right after the newest one,
+    // once the ring has wrapped around.
+    auto oldest = (buffer->next + buffer_capacity - buffer->count) % buffer_capacity;
+
+    for (std::size_t i = 0; i < buffer->count; i++) {
+
+      const auto& event = buffer->events[(oldest + i) % buffer_capacity];
+
+      output << (first ? "\n" : ",\n");
+
+      output << "{\"name\":";
+      write_string(output, event.name);
+      output << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id << ",\"ts\":";
+      write_microseconds(output, event.start_ns);
+      output << ",\"dur\":";
+      write_microseconds(output, event.duration_ns);
+      output << '}';
+
+      first = false;
+    }
+  }
+
+  output << "\n]}\n";
+}
+
+} // namespace herald
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <herald/Profiler.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace herald;
+
+TEST(Profiler, Disabled) {
+
+  Profiler::set_enabled(false);
+  Profiler::clear();
+
+  {
+    ProfileScope scope("Stage");
+  }
+
+  EXPECT_EQ(Profiler::get_event_count(), 0);
+}
+
+TEST(Profiler, ChromeTrace) {
+
+  Profiler::clear();
+  Profiler::set_enabled(true);
+
+  {
+    ProfileScope scope("Main \"Stage\"");
+  }
+
+  std::thread worker([] {
+    ProfileScope scope("Worker Stage");
+  });
+
+  worker.join();
+
+  Profiler::set_enabled(false);
+
+  EXPECT_EQ(Profiler::get_event_count(), 2);
+
+  std::ostringstream stream;
+
+  Profiler::write_chrome_trace(stream);
+
+  auto trace = stream.str();
+
+  EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"Main \\\"Stage\\\"\",\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"Worker Stage\""), std::string::npos);
+
+  Profiler::clear();
+}
+
+TEST(Profiler, RingBuffer) {
+
+  Profiler::clear();
+
+  for (std::size_t i = 0; i < (Profiler::buffer_capacity + 10); i++) {
+    Profiler::record(((i % 2) ? "Odd" : "Even"), i * 1000, (i * 1000) + 1500);
+  }
+
+  EXPECT_EQ(Profiler::get_event_count(), Profiler::buffer_capacity);
+
+  std::ostringstream stream;
+
+  Profiler::write_chrome_trace(stream);
+
+  auto trace = stream.str();
+
+  // The oldest ten events were dropped, and
+  // the first one kept is the oldest remaining.
+  EXPECT_EQ(trace.find("\"ts\":9.000"), std::string::npos);
+  EXPECT_LT(trace.find("\"ts\":10.000,\"dur\":1.500"), trace.find("\"ts\":11.000"));
+
+  Profiler::clear();
+}
+
+TEST(Profiler, ReusesBuffers) {
+
+  Profiler::clear();
+  Profiler::set_enabled(true);
+
+  std::thread first([] {
+    ProfileScope scope("First Worker");
+  });
+
+  first.join();
+
+  auto buffer_count = Profiler::get_buffer_count();
+
+  // Each thread exits before the next one starts,
+  // so they all record into the same buffer.
+  for (int i = 0; i < 8; i++) {
+    std::thread worker([] {
+      ProfileScope scope("Worker");
+    });
+    worker.join();
+  }
+
+  Profiler::set_enabled(false);
+
+  EXPECT_EQ(Profiler::get_buffer_count(), buffer_count);
+
+  // Only the events of the last worker are left in the reused buffer.
+  std::ostringstream stream;
+
+  Profiler::write_chrome_trace(stream);
+
+  EXPECT_EQ(stream.str().find("First Worker"), std::string::npos);
+  EXPECT_NE(stream.str().find("\"name\":\"Worker\""), std::string::npos);
+
+  Profiler::clear();
+}
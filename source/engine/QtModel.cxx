@@ -2,15 +2,17 @@
 
 #include <herald/ActionTable.h>
 #include <herald/AnimationTable.h>
+#include <herald/Camera.h>
 #include <herald/Index.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
-#include <herald/Vector.h>
 
 #include "QtBackground.h"
 #include "QtObjectTable.h"
 #include "QtRoom.h"
 #include "QtTextureTable.h"
 
+#include <QGraphicsItem>
 #include <QGraphicsScene>
 
 namespace herald {
@@ -34,6 +36,12 @@ class QtModelImpl final : public QtModel {
   ScopedPtr<QtRoom> room;
   /// The objects within the model.
   ScopedPtr<QtObjectTable> object_table;
+  /// The camera that the game controls.
+  Camera camera;
+  /// The camera that was last applied to the scene.
+  Camera applied_camera;
+  /// The size of the view, in pixels.
+  QSize view_size;
   /// The total number of ellapsed milliseconds.
   std::size_t ellapsed_ms;
 public:
@@ -46,6 +54,7 @@ public:
       background(QtBackground::make(nullptr)),
       room(QtRoom::make(nullptr)),
       object_table(QtObjectTable::make(nullptr)),
+      view_size(1, 1),
       ellapsed_ms(0) {
 
     scene->addItem(background->get_graphics_item());
@@ -56,17 +65,40 @@ public:
   /// @param delta_ms The value to increase the timeline by.
   void advance(std::size_t delta_ms) override {
 
+    ProfileScope scope("QtModel::advance");
+
     ellapsed_ms += delta_ms;
 
-    auto mod_list = room->update_texture_indices(ellapsed_ms, *animations);
+    if (camera != applied_camera) {
+      apply_camera();
+    }
+
+    // Textures that finish loading late have to be drawn again.
+    if (textures->collect(false) > 0) {
+      room->get_graphics_item()->update();
+      object_table->refresh_textures();
+    }
+
+    {
+      ProfileScope room_scope("QtRoom::update_texture_indices");
+      room->update_texture_indices(ellapsed_ms, *animations);
+    }
+
+    {
+      ProfileScope room_scope("QtRoom::update_textures");
+      room->update_textures(*textures);
+    }
 
-    room->update_textures(mod_list, *textures);
+    auto visible_tiles = room->get_visible_tiles();
 
-    object_table->resize_standard(room->get_tile_size());
-    object_table->update_positions(room->get_tile_size());
-    object_table->update_animation_indices(*actions);
-    object_table->update_texture_indices(ellapsed_ms, *animations);
-    object_table->update_textures(*textures);
+    ProfileScope object_scope("QtObjectTable::update");
+
+    object_table->update(ellapsed_ms,
+                         room->get_tile_size(),
+                         *actions,
+                         *animations,
+                         *textures,
+                         camera.fits_room() ? nullptr : &visible_tiles);
   }
   /// Accesses a pointer to the action table.
   ActionTable* get_action_table() override {
@@ -80,6 +112,10 @@ public:
   Background* get_background() override {
     return background.get();
   }
+  /// Accesses a pointer to the camera.
+  Camera* get_camera() override {
+    return &camera;
+  }
   /// Accesses a pointer to the object map.
   ObjectTable* get_object_table() override {
     return object_table.get();
@@ -102,8 +138,34 @@ public:
   /// so that the model can automatically be scaled.
   /// @param size The size to scale to.
   void resize(const QSize& size) override {
+    view_size = size;
+    textures->clear_scaled();
     background->handle_resize(size);
     room->handle_resize(size);
+    apply_camera();
+  }
+protected:
+  /// Applies the camera to the scene. The scene is limited to
+  /// the part of the room that is in view, and the background
+  /// is moved along with it so that it keeps filling the view.
+  void apply_camera() {
+
+    if (camera.get_tile_size() != applied_camera.get_tile_size()) {
+      textures->clear_scaled();
+    }
+
+    applied_camera = camera;
+
+    room->set_camera(camera);
+
+    auto origin = camera.calculate_origin(std::size_t(view_size.width()),
+                                          std::size_t(view_size.height()));
+
+    QRectF view_rect(origin.x(), origin.y(), view_size.width(), view_size.height());
+
+    scene->setSceneRect(view_rect);
+
+    background->get_graphics_item()->setPos(view_rect.topLeft());
   }
 };
 
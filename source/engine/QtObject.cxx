@@ -1,5 +1,6 @@
 #include "QtObject.h"
 
+#include <herald/Index.h>
 #include <herald/ScopedPtr.h>
 #include <herald/Vec2f.h>
 
@@ -7,6 +8,7 @@
 
 #include <QGraphicsRectItem>
 #include <QPen>
+#include <QPixmap>
 
 namespace herald {
 
@@ -25,7 +27,8 @@ public:
   }
   /// Resizes the object to a new standard reference size.
   /// @param standard_size The standard reference size to adjust to.
-  void resize(const QSize& standard_size) override {
+  /// @param pos The position of the object.
+  void resize(const QSize& standard_size, const Vec2f& pos) override {
 
     /// Currently not using scale factors. If
     /// we were, then this function would account for
@@ -48,18 +51,15 @@ public:
     float w_factor = ((float) w_final) / w_initial;
     float h_factor = ((float) h_final) / h_initial;
 
-    auto pos = get_position();
-
     item->setRect(pos.x() * standard_size.width(),
                   pos.y() * standard_size.height(),
                   w_factor * item_rect.width(),
                   h_factor * item_rect.height());
   }
   /// Updates the scene position of the object.
+  /// @param pos The position of the object.
   /// @param tile_size The size of a tile, used for reference.
-  void update_position(const QSize& tile_size) override {
-
-    auto pos = get_position();
+  void update_position(const Vec2f& pos, const QSize& tile_size) override {
 
     auto item_rect = item->rect();
     auto w = item_rect.width();
@@ -70,18 +70,25 @@ public:
 
     item->setRect(QRectF(x, y, w, h));
   }
+  /// Shows or hides the object.
+  void set_visible(bool visible) override {
+    item->setVisible(visible);
+  }
+  /// Indicates whether or not the object is shown.
+  bool is_visible() const override {
+    return item->isVisible();
+  }
   /// Updates the texture used to display the object.
-  void update_texture(const QtTextureTable& textures) override {
+  void update_texture(Index texture_index, const QtTextureTable& textures) override {
 
-    auto pixmap = textures.at(get_texture_index());
-
-    if (!pixmap.isNull()) {
+    auto item_rect = item->rect();
 
-      auto item_rect = item->rect();
+    auto item_size = QSize(item_rect.width(), item_rect.height());
 
-      auto item_size = QSize(item_rect.width(), item_rect.height());
+    auto pixmap = textures.scaled(texture_index, item_size);
 
-      item->setBrush(pixmap.scaled(item_size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    if (!pixmap.isNull()) {
+      item->setBrush(pixmap);
     }
   }
 };
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <herald/Object.h>
-
 class QGraphicsItem;
 class QSize;
 
@@ -10,10 +8,14 @@ namespace herald {
 template <typename T>
 class ScopedPtr;
 
+class Index;
 class QtTextureTable;
+class Vec2f;
 
-/// The Qt interface for an object.
-class QtObject : public Object {
+/// The Qt interface for an object. This only displays
+/// an object, the state of the object is kept in the
+/// @ref ObjectStore of the object table.
+class QtObject {
 public:
   /// Creates a new Qt object instance.
   /// @param parent A pointer to the parent graphics item.
@@ -24,13 +26,21 @@ public:
   /// Adjusts the object size to account for
   /// a change in the standard size of an object.
   /// @param standard_size The new standard reference size.
-  virtual void resize(const QSize& standard_size) = 0;
+  /// @param position The position of the object.
+  virtual void resize(const QSize& standard_size, const Vec2f& position) = 0;
   /// Updates the position of the object.
+  /// @param position The position of the object.
   /// @param tile_size The size of a single tile, used for reference.
-  virtual void update_position(const QSize& tile_size) = 0;
+  virtual void update_position(const Vec2f& position, const QSize& tile_size) = 0;
+  /// Shows or hides the object.
+  /// @param visible Whether or not the object should be shown.
+  virtual void set_visible(bool visible) = 0;
+  /// Indicates whether or not the object is shown.
+  virtual bool is_visible() const = 0;
   /// Updates the texture used to display the object.
+  /// @param texture_index The index of the texture to display.
   /// @param textures The texture table to get the texture from.
-  virtual void update_texture(const QtTextureTable& textures) = 0;
+  virtual void update_texture(Index texture_index, const QtTextureTable& textures) = 0;
 };
 
 } // namespace herald
@@ -1,5 +1,7 @@
 #include "QtObjectTable.h"
 
+#include <herald/Camera.h>
+#include <herald/ObjectStore.h>
 #include <herald/ScopedPtr.h>
 
 #include "QtObject.h"
@@ -16,23 +18,34 @@ namespace {
 class QtObjectTableImpl final : public QtObjectTable {
   /// The graphics item group to put the objects into.
   ScopedPtr<QGraphicsItemGroup> item_group;
-  /// The objects added to the object table.
+  /// The state of the objects in the table.
+  ObjectStore store;
+  /// The graphics items that display the objects,
+  /// one for each object in the store.
   std::vector<ScopedPtr<QtObject>> objects;
   /// The standard reference size for all objects.
   QSize standard_size;
+  /// The tiles that were in view during the last update.
+  TileRange last_visible_tiles;
+  /// Whether or not the objects were culled during the last update.
+  bool culled;
 public:
   /// Constructs a new instance of the Qt object table.
   /// @param parent A pointer to the parent graphics item.
-  QtObjectTableImpl(QGraphicsItem* parent) : item_group(new QGraphicsItemGroup(parent)), standard_size(1, 1) {
+  QtObjectTableImpl(QGraphicsItem* parent)
+    : item_group(new QGraphicsItemGroup(parent)),
+      standard_size(1, 1),
+      last_visible_tiles(TileRange { 0, 0, 0, 0 }),
+      culled(false) {
     item_group->setZValue(1);
   }
-  /// Accesses an object at a specific index.
-  Object* at(Index index) override {
-    if (index >= objects.size()) {
-      return Object::get_null_object();
-    } else {
-      return objects[index].get();
-    }
+  /// Translates an object.
+  void translate(Index index, const Vec2f& delta_pos) override {
+    store.translate(index, delta_pos);
+  }
+  /// Sets the action of an object.
+  void set_action_index(Index index, Index action_index) override {
+    store.set_action_index(index, action_index);
   }
   /// Accesses a pointer to the graphics item.
   /// @returns A pointer to the graphics item.
@@ -43,6 +56,8 @@ public:
   /// @param count The number of objects to keep in the table.
   void resize(std::size_t count) override {
 
+    store.resize(count);
+
     /* Handle collapse */
     if (count < objects.size()) {
       objects.resize(count);
@@ -53,44 +68,87 @@ public:
       objects.emplace_back(QtObject::make(item_group.get()));
     }
   }
-  /// Resizes the standard reference size for all objects.
-  /// @param size The new standard size to adjust to.
-  void resize_standard(const QSize& size) override {
-
-    standard_size = size;
-
-    for (auto& obj : objects) {
-      if (obj) {
-        obj->resize(standard_size);
-      }
-    }
-  }
   /// Indicates the number of items
   /// in the object table.
   std::size_t size() const noexcept override {
-    return objects.size();
+    return store.size();
   }
-  /// Updates the object positions.
-  void update_positions(const QSize& tile_size) override {
-    for (auto& obj : objects) {
-      if (obj) {
-        obj->update_position(tile_size);
-      }
-    }
+  /// Updates the animation indices of the objects.
+  void update_animation_indices(const ActionTable& actions) override {
+    store.update_animation_indices(actions);
   }
-  /// Updates the texture indices assigned to each of the objects.
-  /// @param ellapsed_ms The total number of ellapsed milliseconds.
-  /// @param animations A reference to the animation table.
-  void update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) override {
-    for (auto& obj : objects) {
-      obj->update_texture_index(ellapsed_ms, animations);
-    }
+  /// Marks the texture of every object as changed.
+  void refresh_textures() override {
+    store.mark_all_changed(ObjectChange::Texture);
   }
-  /// Updates the textures assigned to each of the objects.
-  void update_textures(const QtTextureTable& textures) override {
-    for (auto& obj : objects) {
-      obj->update_texture(textures);
+  /// Brings the objects up to date for a frame.
+  void update(std::size_t ellapsed_ms,
+              const QSize& tile_size,
+              const ActionTable& actions,
+              const AnimationTable& animations,
+              const QtTextureTable& textures,
+              const TileRange* visible_tiles) override {
+
+    if (tile_size != standard_size) {
+      standard_size = tile_size;
+      store.mark_all_changed(ObjectChange::Size);
+    }
+
+    // When the view moves, objects may come into view or leave it.
+    // Objects are placed in scene coordinates, so the ones that stay
+    // in view (or out of it) don't have to be updated.
+    if ((visible_tiles != nullptr) != culled) {
+      store.mark_all_changed(ObjectChange::Position);
+      culled = (visible_tiles != nullptr);
+    } else if (visible_tiles && (*visible_tiles != last_visible_tiles)) {
+      store.mark_changed_between(last_visible_tiles, *visible_tiles, ObjectChange::Position);
+    }
+
+    if (visible_tiles) {
+      last_visible_tiles = *visible_tiles;
+    }
+
+    store.update_animation_indices(actions);
+
+    store.update_texture_indices(ellapsed_ms, animations);
+
+    auto end = store.get_changed_end();
+
+    for (auto i = store.get_changed_begin(); i < end; i++) {
+
+      if (!store.has_changes(i)) {
+        continue;
+      }
+
+      auto size_changed = store.has_change(i, ObjectChange::Size);
+
+      auto& obj = objects[i];
+
+      if (visible_tiles && !visible_tiles->overlaps(store.get_position(i))) {
+        obj->set_visible(false);
+        continue;
+      }
+
+      // Changes made while the object was hidden weren't applied.
+      if (!obj->is_visible()) {
+        obj->set_visible(true);
+        size_changed = true;
+      }
+
+      if (size_changed) {
+        obj->resize(standard_size, store.get_position(i));
+      }
+
+      if (size_changed || store.has_change(i, ObjectChange::Position)) {
+        obj->update_position(store.get_position(i), standard_size);
+      }
+
+      if (size_changed || store.has_change(i, ObjectChange::Texture)) {
+        obj->update_texture(store.get_texture_index(i), textures);
+      }
     }
+
+    store.clear_changes();
   }
 };
 
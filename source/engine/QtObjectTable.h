@@ -12,9 +12,12 @@ namespace herald {
 template <typename T>
 class ScopedPtr;
 
+class ActionTable;
 class AnimationTable;
 class QtTextureTable;
 
+struct TileRange;
+
 /// The Qt interface for an object table.
 class QtObjectTable : public ObjectTable {
 public:
@@ -27,19 +30,30 @@ public:
   /// Accesses a pointer to the graphics item.
   /// @returns A pointer to the graphics item.
   virtual QGraphicsItem* get_graphics_item() = 0;
-  /// Resizes the objects in the object table to a new standard size.
-  /// @param size The new size standard to adjust the objects to.
-  virtual void resize_standard(const QSize& size) = 0;
-  /// Updates the positions of the objects on the scene.
-  /// @param tile_size The size of a tile, used as a reference for tableping coordinates.
-  virtual void update_positions(const QSize& tile_size) = 0;
-  /// Updates the texture indices for the objects.
+  /// Marks the texture of every object as changed, so that
+  /// it's applied again on the next update. This is used when
+  /// textures finish loading after the objects were drawn.
+  virtual void refresh_textures() = 0;
+  /// Brings the objects up to date for a frame. The indices
+  /// of all the objects are updated in batches, then only the
+  /// range of objects that changed is visited, and only the parts
+  /// of them that changed are applied to their graphics items.
+  /// Objects outside of the visible tiles are hidden and skipped,
+  /// then brought up to date once they come back into view.
   /// @param ellapsed_ms The total number of ellapsed milliseconds during game play.
+  /// @param tile_size The size of a tile, used as the standard object size
+  /// and as the reference for mapping object coordinates.
+  /// @param actions The action table to get the animation indices from.
   /// @param animations The animation table to get the texture indices from.
-  virtual void update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
-  /// Updates the textures assigned to each of the objects.
   /// @param textures The texture table to get the textures from.
-  virtual void update_textures(const QtTextureTable& textures) = 0;
+  /// @param visible_tiles The tiles that are in view. If this is
+  /// null, then all of the objects are considered to be in view.
+  virtual void update(std::size_t ellapsed_ms,
+                      const QSize& tile_size,
+                      const ActionTable& actions,
+                      const AnimationTable& animations,
+                      const QtTextureTable& textures,
+                      const TileRange* visible_tiles) = 0;
 };
 
 } // namespace herald
@@ -1,46 +1,233 @@
 #include "QtRoom.h"
 
+#include <herald/Camera.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
-#include <herald/Vector.h>
 
-#include "QtModel.h"
+#include "QtTextureTable.h"
 #include "QtTile.h"
+#include "TileScheduler.h"
 
-#include <QGraphicsItemGroup>
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QPixmap>
+#include <QStyleOptionGraphicsItem>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace herald {
 
 namespace {
 
+/// The graphics item that displays the room.
+/// It's the only item in the scene for the room, regardless
+/// of how many tiles there are. When it's painted, only the
+/// tiles in the exposed area are drawn, and the tiles that
+/// share a texture are drawn with one call.
+class QtRoomItem final : public QGraphicsItem {
+  /// The tiles of the room, row by row.
+  const std::vector<QtTile>* tiles;
+  /// The textures to paint the tiles with.
+  const QtTextureTable* textures;
+  /// The number of tiles per row.
+  int columns;
+  /// The number of rows of tiles.
+  int rows;
+  /// The size of one tile, in pixels.
+  QSize tile_size;
+  /// The texture and index of each tile being
+  /// painted, sorted so that textures are grouped.
+  std::vector<std::pair<std::size_t, std::size_t>> visible_tiles;
+  /// The fragments of one group of tiles.
+  std::vector<QPainter::PixmapFragment> fragments;
+public:
+  /// Constructs the room item.
+  /// @param tiles_ The tiles that the item displays.
+  /// @param parent A pointer to the parent graphics item.
+  QtRoomItem(const std::vector<QtTile>* tiles_, QGraphicsItem* parent)
+    : QGraphicsItem(parent),
+      tiles(tiles_),
+      textures(nullptr),
+      columns(0),
+      rows(0),
+      tile_size(0, 0) {
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+  }
+  /// Accesses the bounding rectangle of the room.
+  QRectF boundingRect() const override {
+    // Taken in qreal, since a large room at a
+    // large tile size may overflow an int.
+    return QRectF(0, 0,
+                  qreal(tile_size.width())  * columns,
+                  qreal(tile_size.height()) * rows);
+  }
+  /// Draws the tiles in the exposed area.
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*) override {
+
+    ProfileScope scope("QtRoom::paint");
+
+    if (!textures || tile_size.isEmpty()) {
+      return;
+    }
+
+    auto w = tile_size.width();
+    auto h = tile_size.height();
+
+    auto exposed = option->exposedRect.toAlignedRect().intersected(boundingRect().toRect());
+
+    if (exposed.isEmpty()) {
+      return;
+    }
+
+    auto x_min = exposed.left() / w;
+    auto y_min = exposed.top() / h;
+    auto x_max = std::min((exposed.right() / w) + 1, columns);
+    auto y_max = std::min((exposed.bottom() / h) + 1, rows);
+
+    visible_tiles.clear();
+
+    for (auto y = y_min; y < y_max; y++) {
+      for (auto x = x_min; x < x_max; x++) {
+        auto index = std::size_t((y * columns) + x);
+        auto texture_index = (*tiles)[index].get_texture_index();
+        if (texture_index.valid()) {
+          visible_tiles.emplace_back(texture_index, index);
+        }
+      }
+    }
+
+    std::sort(visible_tiles.begin(), visible_tiles.end());
+
+    QRectF source(0, 0, w, h);
+
+    std::size_t group_begin = 0;
+
+    while (group_begin < visible_tiles.size()) {
+
+      auto texture_index = visible_tiles[group_begin].first;
+
+      auto group_end = group_begin;
+
+      fragments.clear();
+
+      for (; (group_end < visible_tiles.size()) && (visible_tiles[group_end].first == texture_index); group_end++) {
+
+        auto index = int(visible_tiles[group_end].second);
+
+        QPointF center(((index % columns) * w) + (w / 2.0),
+                       ((index / columns) * h) + (h / 2.0));
+
+        fragments.push_back(QPainter::PixmapFragment::create(center, source));
+      }
+
+      auto pixmap = textures->scaled(texture_index, tile_size);
+
+      if (!pixmap.isNull()) {
+        painter->drawPixmapFragments(fragments.data(), int(fragments.size()), pixmap);
+      }
+
+      group_begin = group_end;
+    }
+  }
+  /// Assigns the textures to paint the tiles with.
+  void set_textures(const QtTextureTable* textures_) noexcept {
+    textures = textures_;
+  }
+  /// Changes the layout of the tiles.
+  /// @param columns_ The number of tiles per row.
+  /// @param rows_ The number of rows of tiles.
+  /// @param tile_size_ The size of one tile, in pixels.
+  void set_layout(int columns_, int rows_, const QSize& tile_size_) {
+    prepareGeometryChange();
+    columns = columns_;
+    rows = rows_;
+    tile_size = tile_size_;
+  }
+  /// Calculates the area that a tile is painted in.
+  /// @param index The index of the tile.
+  QRect get_tile_rect(std::size_t index) const {
+    auto x = int(index % std::size_t(columns));
+    auto y = int(index / std::size_t(columns));
+    return QRect(x * tile_size.width(),
+                 y * tile_size.height(),
+                 tile_size.width(),
+                 tile_size.height());
+  }
+};
+
+/// The number of tiles around the view that
+/// are kept up to date, so that tiles coming
+/// into view have the right texture.
+const std::size_t view_margin = 2;
+
 /// An implementation of a Qt room.
 class QtRoomImpl final : public QtRoom {
-  /// The graphics item group to put the tiles into.
-  ScopedPtr<QGraphicsItemGroup> item_group;
+  /// The graphics item displaying the room.
+  ScopedPtr<QtRoomItem> item;
   /// The tiles that are part of the room.
-  std::vector<ScopedPtr<QtTile>> tiles;
+  std::vector<QtTile> tiles;
+  /// Decides which tiles are updated as time passes.
+  ScopedPtr<TileScheduler> scheduler;
+  /// The tiles that have to be repainted.
+  std::vector<std::size_t> dirty_tiles;
   /// The size of the display, in terms of pixels.
   QSize display_size;
+  /// The camera that the room is seen through.
+  Camera camera;
+  /// The tiles that are in view, plus a margin.
+  TileRange visible_tiles;
+  /// Whether or not every tile has to be repainted.
+  bool repaint_all;
+  /// Whether or not a tile was handed out by @ref at,
+  /// in which case its animation may have been changed
+  /// without the scheduler knowing about it.
+  bool tiles_exposed;
+  /// Whether or not the scheduler has fallen behind,
+  /// because only the tiles in view were updated.
+  bool scheduler_stale;
 public:
   /// Constructs the room instance.
   /// @param parent A pointer to the parent graphics item.
-  QtRoomImpl(QGraphicsItem* parent) : item_group(new QGraphicsItemGroup(parent)), display_size(1, 1) {
-
-  }
+  QtRoomImpl(QGraphicsItem* parent)
+    : item(new QtRoomItem(&tiles, parent)),
+      scheduler(TileScheduler::make()),
+      display_size(1, 1),
+      visible_tiles(TileRange { 0, 0, 0, 0 }),
+      repaint_all(true),
+      tiles_exposed(false),
+      scheduler_stale(false) {}
   /// Accesses a tile at a specific coordinate.
   /// @param x The X coordinate of the tile.
   /// @param y The Y coordinate of the tile.
   /// @returns A pointer to the specified tile.
   Tile* at(std::size_t x, std::size_t y) override {
     if ((x < width()) && (y < height())) {
-      return tiles[(y * width()) + x].get();
+      tiles_exposed = true;
+      return &tiles[(y * width()) + x];
     } else {
       return Tile::get_null_tile();
     }
   }
+  /// Assigns the animation indices of the tiles.
+  /// @param indices The animation indices, row by row.
+  /// @param count The number of animation indices.
+  void assign_animation_indices(const int* indices, std::size_t count) override {
+
+    auto tile_count = tiles.size();
+
+    for (std::size_t i = 0; (i < count) && (i < tile_count); i++) {
+      tiles[i].set_animation_index((std::size_t) indices[i]);
+      scheduler->assign(i, tiles[i].get_animation_index());
+    }
+  }
   /// Gets the tile size of the room.
   /// @returns The tile size of the room.
   QSize get_tile_size() const noexcept override {
-    if (!width() || !height()) {
+    if (!camera.fits_room()) {
+      return QSize(int(camera.get_tile_size()), int(camera.get_tile_size()));
+    } else if (!width() || !height()) {
       return QSize(0, 0);
     } else {
       return QSize(display_size.width()  / width(),
@@ -55,92 +242,190 @@ public:
 
     adjust_tile_size();
   }
+  /// Changes the camera of the room.
+  void set_camera(const Camera& next_camera) override {
+
+    auto resized = (next_camera.get_tile_size() != camera.get_tile_size());
+
+    camera = next_camera;
+
+    if (resized) {
+      adjust_tile_size();
+    } else {
+      update_visible_tiles();
+    }
+  }
+  /// Accesses the range of tiles in view.
+  TileRange get_visible_tiles() const noexcept override {
+    return visible_tiles;
+  }
   /// Accesses a pointer to the graphics item.
   QGraphicsItem* get_graphics_item() override {
-    return item_group.get();
+    return item.get();
   }
   /// Resizes the number of tiles in the room.
   /// @param width The width to assign the room.
   /// @param height The height to assign the room.
   void resize(std::size_t width, std::size_t height) override {
 
-    auto prev_size = tiles.size();
-    auto next_size = width * height;
-
-    for (auto i = prev_size; i < next_size; i++) {
-      tiles.emplace_back(QtTile::make(item_group.get()));
-    }
+    tiles.resize(width * height);
 
     Room::resize(width, height);
 
+    scheduler->resize(tiles.size());
+
+    sync_scheduler();
+
     adjust_tile_size();
   }
-  /// Updates the texture indices for the tiles.
+  /// Updates the texture indices of the tiles that the
+  /// scheduler wakes up, or of the tiles in view if only
+  /// part of the room is in view. The tiles that change
+  /// are queued for repainting.
   /// @param ellapsed_ms The updated timeline value.
   /// @param animation A reference to the animation table to get the texture indices from.
-  /// @returns A list of indices indicating which tiles were updated.
-  Vector<std::size_t> update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) override {
+  /// @returns The number of tiles that were updated.
+  std::size_t update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) override {
+
+    if (visible_tiles.size() < tiles.size()) {
+      scheduler_stale = true;
+      tiles_exposed = false;
+      return update_visible_texture_indices(ellapsed_ms, animations);
+    }
 
-    Vector<std::size_t> update_list;
+    if (scheduler_stale) {
+      scheduler->resize(tiles.size());
+      scheduler_stale = false;
+      tiles_exposed = true;
+    }
 
-    for (std::size_t i = 0; i < tiles.size(); i++) {
-      if (tiles[i]->update_texture_index(ellapsed_ms, animations)) {
-        update_list.push_back(i);
+    if (tiles_exposed) {
+      sync_scheduler();
+      tiles_exposed = false;
+    }
+
+    auto woken_count = scheduler->advance(ellapsed_ms, animations);
+
+    const auto* woken = scheduler->get_woken_tiles();
+
+    std::size_t changed = 0;
+
+    for (std::size_t i = 0; i < woken_count; i++) {
+
+      auto& tile = tiles[woken[i]];
+
+      auto was_dirty = tile.is_dirty();
+
+      if (!tile.update_texture_index(ellapsed_ms, animations)) {
+        continue;
+      }
+
+      changed++;
+
+      if (!was_dirty && !repaint_all) {
+        dirty_tiles.push_back(woken[i]);
       }
     }
 
-    return update_list;
+    return changed;
   }
-  /// Updates the textures mapped onto each of the tiles.
-  /// @param mod_list A list of which tiles had their texture indices changed.
-  /// @param textures The texture table to update the tiles with.
-  void update_textures(const Vector<std::size_t>& mod_list, const QtTextureTable& textures) override {
-    for (const auto& tile_index : mod_list) {
-      tiles[tile_index]->update_texture(textures);
+  /// Schedules the dirty tiles for repainting.
+  /// @param textures The texture table to paint the tiles with.
+  void update_textures(const QtTextureTable& textures) override {
+
+    item->set_textures(&textures);
+
+    if (get_tile_size().isEmpty()) {
+      return;
     }
+
+    if (repaint_all) {
+      for (auto& tile : tiles) {
+        tile.mark_clean();
+      }
+      item->update();
+    } else if (!dirty_tiles.empty()) {
+
+      QRect dirty_rect;
+
+      for (auto i : dirty_tiles) {
+        tiles[i].mark_clean();
+        dirty_rect = dirty_rect.united(item->get_tile_rect(i));
+      }
+
+      item->update(dirty_rect);
+    }
+
+    dirty_tiles.clear();
+
+    repaint_all = false;
   }
 protected:
-  /// Adjusts the tile size to account for either
-  /// a new window size or new room dimensions.
+  /// Adjusts the layout of the room item to account for
+  /// either a new window size or new room dimensions. Since
+  /// the tiles change size, all of them are marked for repainting.
   void adjust_tile_size() {
 
-    auto resize_functor = [this](std::size_t x, std::size_t y, QtTile& tile) {
+    item->set_layout(int(width()), int(height()), get_tile_size());
 
-      QSize tile_size(display_size.width()  / width(),
-                      display_size.height() / height());
+    update_visible_tiles();
 
-      QRectF tile_rect(x * tile_size.width(),
-                       y * tile_size.height(),
-                       tile_size.width(),
-                       tile_size.height());
+    for (auto& tile : tiles) {
+      tile.mark_dirty();
+    }
 
-      tile.set_rect(tile_rect);
-    };
+    dirty_tiles.clear();
 
-    iterate(resize_functor);
+    repaint_all = true;
+  }
+  /// Calculates the range of tiles that are in view.
+  void update_visible_tiles() {
+    visible_tiles = camera.calculate_visible_tiles(std::size_t(display_size.width()),
+                                                   std::size_t(display_size.height()),
+                                                   width(),
+                                                   height(),
+                                                   view_margin);
   }
-  /// Iterates the tiles.
-  /// @param functor The function to call on each tile.
-  /// @returns True on success, false if there was an internal error.
-  template <typename Functor>
-  bool iterate(Functor functor) {
+  /// Updates the texture index of every tile in view.
+  /// This is used instead of the scheduler when only part
+  /// of the room is in view, since the scheduler would wake
+  /// up the tiles of an animation across the whole room.
+  /// @param ellapsed_ms The updated timeline value.
+  /// @param animations The animation table to get the texture indices from.
+  /// @returns The number of tiles that were updated.
+  std::size_t update_visible_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) {
 
-    if (tiles.size() != (width() * height())) {
-      return false;
-    }
+    std::size_t changed = 0;
+
+    for (auto y = visible_tiles.y_min; y < visible_tiles.y_max; y++) {
+
+      for (auto x = visible_tiles.x_min; x < visible_tiles.x_max; x++) {
+
+        auto index = (y * width()) + x;
+
+        auto& tile = tiles[index];
+
+        auto was_dirty = tile.is_dirty();
 
-    for (std::size_t y = 0; y < height(); y++) {
-      for (std::size_t x = 0; x < width(); x++) {
-        auto& tile_ptr = tiles[(y * width()) + x];
-        if (!tile_ptr) {
+        if (!tile.update_texture_index(ellapsed_ms, animations)) {
           continue;
-        } else {
-          functor(x, y, *tile_ptr);
+        }
+
+        changed++;
+
+        if (!was_dirty && !repaint_all) {
+          dirty_tiles.push_back(index);
         }
       }
     }
 
-    return true;
+    return changed;
+  }
+  /// Passes the animation of every tile to the scheduler.
+  void sync_scheduler() {
+    for (std::size_t i = 0; i < tiles.size(); i++) {
+      scheduler->assign(i, tiles[i].get_animation_index());
+    }
   }
 };
 
@@ -8,12 +8,16 @@ class QSize;
 namespace herald {
 
 template <typename T> class ScopedPtr;
-template <typename T> class Vector;
 
 class AnimationTable;
+class Camera;
 class QtTextureTable;
 
-/// The Qt interface for a room.
+struct TileRange;
+
+/// The Qt interface for a room. The whole room is one
+/// graphics item, which only paints the tiles that are
+/// exposed, and only the tiles that change are repainted.
 class QtRoom : public Room {
 public:
   /// Creates a new Qt room instance.
@@ -30,16 +34,26 @@ public:
   /// Handles a window resize event.
   /// @param size The window size to scale to.
   virtual void handle_resize(const QSize& size) = 0;
-  /// Updates the texture indices used for each tile in the room.
+  /// Changes the camera that the room is seen through.
+  /// @param camera The camera to apply.
+  virtual void set_camera(const Camera& camera) = 0;
+  /// Accesses the range of tiles that are in view,
+  /// including a small margin around the view.
+  virtual TileRange get_visible_tiles() const noexcept = 0;
+  /// Updates the texture indices of the tiles in the room.
+  /// When the whole room is in view, only the tiles whose animation
+  /// changed frames are visited. Otherwise, only the tiles in view are
+  /// visited, so that the cost depends on the size of the view instead
+  /// of the size of the room. The tiles whose texture index changed are
+  /// marked for repainting.
   /// @param ellapsed_ms The updated number of ellapsed milliseconds.
   /// @param animations A reference to the animation table.
-  /// @returns A list of tile indices that indicate which ones have been updated.
-  virtual Vector<std::size_t> update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
-  /// Updates the textures assigned to each of the tiles.
-  /// This should be called after the frame indices have been updated.
-  /// @param mod_list A list of which tiles had their texture indices changed.
+  /// @returns The number of tiles whose texture index changed.
+  virtual std::size_t update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
+  /// Schedules the tiles that were marked for repainting.
+  /// This should be called after the texture indices have been updated.
   /// @param textures The textures to map onto the tiles.
-  virtual void update_textures(const Vector<std::size_t>& mod_list, const QtTextureTable& textures) = 0;
+  virtual void update_textures(const QtTextureTable& textures) = 0;
 };
 
 } // namespace herald
@@ -1,12 +1,20 @@
 #include <herald/QtTarget.h>
 
+#include <herald/OverlayStats.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
 
 #include "QtKeyController.h"
 #include "QtModel.h"
 
+#include <QGraphicsScene>
 #include <QGraphicsView>
+#include <QKeyEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPolygonF>
 #include <QResizeEvent>
+#include <QString>
 
 #include <vector>
 
@@ -14,6 +22,27 @@ namespace herald {
 
 namespace {
 
+/// The key that shows and hides the performance overlay.
+const int overlay_key = Qt::Key_F3;
+
+/// The area of the viewport taken by the performance overlay.
+const QRect overlay_rect(8, 8, 248, 156);
+
+/// The area of the overlay taken by the frame time sparkline.
+const QRect sparkline_rect(16, 112, 232, 44);
+
+/// Formats a byte count in megabytes.
+/// @param bytes The byte count to format.
+QString format_mb(std::size_t bytes) {
+  return QString::number(((double) bytes) / (1024.0 * 1024.0), 'f', 1);
+}
+
+/// Formats a time in milliseconds.
+/// @param ns The time to format, in nanoseconds.
+QString format_ms(std::uint64_t ns) {
+  return QString::number(((double) ns) / 1000000.0, 'f', 2);
+}
+
 /// A derived graphics view to setup the coordinate system.
 class GraphicsView final : public QGraphicsView {
   /// The models connected to the graphics view.
@@ -22,10 +51,14 @@ class GraphicsView final : public QGraphicsView {
   std::vector<QtModel*> connected_models;
   /// The controller instance.
   QtKeyController controller;
+  /// The statistics shown by the performance overlay.
+  OverlayStats overlay_stats;
+  /// Whether or not the performance overlay is visible.
+  bool overlay_visible;
 public:
   /// Constructs the graphics view.
   /// @param parent A pointer to the parent widget.
-  GraphicsView(QWidget* parent) : QGraphicsView(parent), controller(nullptr) {
+  GraphicsView(QWidget* parent) : QGraphicsView(parent), controller(nullptr), overlay_visible(false) {
     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
     setFrameStyle(QFrame::NoFrame);
@@ -39,17 +72,58 @@ public:
   Controller* get_controller() noexcept {
     return &controller;
   }
+  /// Accesses the statistics of the performance overlay.
+  OverlayStats* get_overlay_stats() noexcept {
+    return &overlay_stats;
+  }
+  /// Indicates whether or not the performance overlay is visible.
+  bool is_overlay_visible() const noexcept {
+    return overlay_visible;
+  }
+  /// Repaints the area of the performance overlay, if it's visible.
+  /// Only the scene items that changed are repainted otherwise,
+  /// which would leave the overlay out of date.
+  void update_overlay() {
+    if (overlay_visible) {
+      viewport()->update(overlay_rect);
+    }
+  }
 protected:
   /// Handles a key press event, updating controller states.
+  /// The overlay key toggles the performance overlay instead.
   void keyPressEvent(QKeyEvent* event) override {
+    if (event->key() == overlay_key) {
+      if (!event->isAutoRepeat()) {
+        overlay_visible = !overlay_visible;
+        viewport()->update(overlay_rect);
+      }
+      return;
+    }
     controller.handle_key_press(event);
     return QGraphicsView::keyPressEvent(event);
   }
   /// Handles a key release event, updating controller states.
   void keyReleaseEvent(QKeyEvent* event) override {
+    if (event->key() == overlay_key) {
+      return;
+    }
     controller.handle_key_release(event);
     return QGraphicsView::keyReleaseEvent(event);
   }
+  /// Draws the performance overlay over the scene, if it's visible.
+  void drawForeground(QPainter* painter, const QRectF& rect) override {
+
+    QGraphicsView::drawForeground(painter, rect);
+
+    if (overlay_visible) {
+      draw_overlay(*painter);
+    }
+  }
+  /// Paints the scene, timing it for the profiler.
+  void paintEvent(QPaintEvent* event) override {
+    ProfileScope scope("QGraphicsView::paintEvent");
+    QGraphicsView::paintEvent(event);
+  }
   /// Overrides the resize event handler
   /// so that the engine can also handle
   /// resize events.
@@ -63,6 +137,72 @@ protected:
 
     QGraphicsView::resizeEvent(event);
   }
+  /// Draws the performance overlay in viewport coordinates.
+  /// @param painter The painter of the viewport.
+  void draw_overlay(QPainter& painter) {
+
+    painter.save();
+
+    painter.resetTransform();
+
+    painter.fillRect(overlay_rect, QColor(0, 0, 0, 176));
+
+    auto last_ns = overlay_stats.get_frame_count()
+                 ? overlay_stats.get_frame_ns(overlay_stats.get_frame_count() - 1)
+                 : 0;
+
+    auto max_ns = overlay_stats.get_max_frame_ns();
+
+    QString textures = format_mb(overlay_stats.get_texture_bytes());
+    if (overlay_stats.get_texture_budget()) {
+      textures += " / " + format_mb(overlay_stats.get_texture_budget());
+    }
+
+    QString text;
+    text += "FPS: " + QString::number(overlay_stats.get_fps(), 'f', 1) + '\n';
+    text += "Frame: " + format_ms(last_ns) + " ms (max " + format_ms(max_ns) + ")\n";
+    text += "Queue: " + QString::number(overlay_stats.get_queue_depth())
+          + " (last RTT " + format_ms(overlay_stats.get_last_rtt_ns()) + " ms)\n";
+    text += "Textures: " + textures + " MB\n";
+    text += "Items: " + QString::number(scene() ? scene()->items().size() : 0);
+
+    painter.setPen(Qt::white);
+    painter.drawText(overlay_rect.adjusted(8, 6, -8, -48), Qt::AlignLeft | Qt::AlignTop, text);
+
+    draw_sparkline(painter, max_ns);
+
+    painter.restore();
+  }
+  /// Draws the recent frame times as a line, with the
+  /// longest one reaching the top of the sparkline area.
+  /// @param painter The painter of the viewport.
+  /// @param max_ns The longest of the recent frame times.
+  void draw_sparkline(QPainter& painter, std::uint64_t max_ns) {
+
+    auto count = overlay_stats.get_frame_count();
+    if ((count < 2) || !max_ns) {
+      return;
+    }
+
+    QPolygonF line;
+
+    line.reserve((int) count);
+
+    auto x_step = ((double) sparkline_rect.width()) / (double) (OverlayStats::history_size - 1);
+
+    // The newest frame is at the right edge, so that
+    // the line scrolls to the left as frames are added.
+    auto x = sparkline_rect.right() - (x_step * (double) (count - 1));
+
+    for (std::size_t i = 0; i < count; i++) {
+      auto height = ((double) overlay_stats.get_frame_ns(i)) / (double) max_ns;
+      line << QPointF(x, sparkline_rect.bottom() - (height * sparkline_rect.height()));
+      x += x_step;
+    }
+
+    painter.setPen(QColor(96, 224, 96));
+    painter.drawPolyline(line);
+  }
 };
 
 /// Implements the Qt target interface.
@@ -85,6 +225,18 @@ public:
   Controller* get_controller() noexcept override {
     return graphics_view->get_controller();
   }
+  /// Accesses the statistics of the performance overlay.
+  OverlayStats* get_overlay_stats() override {
+    return graphics_view->get_overlay_stats();
+  }
+  /// Indicates whether or not the performance overlay is visible.
+  bool is_overlay_visible() const override {
+    return graphics_view->is_overlay_visible();
+  }
+  /// Repaints the performance overlay, if it's visible.
+  void update_overlay() override {
+    graphics_view->update_overlay();
+  }
   /// Shows the graphics window.
   void show() override {
     graphics_view->show();
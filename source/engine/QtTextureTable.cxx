@@ -1,39 +1,383 @@
 #include "QtTextureTable.h"
 
 #include <herald/Index.h>
+#include <herald/Profiler.h>
 #include <herald/ScopedPtr.h>
 
+#include <QImage>
 #include <QPixmap>
+#include <QRunnable>
+#include <QSize>
+#include <QString>
+#include <QThreadPool>
 
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace herald {
 
 namespace {
 
+/// A texture that was scaled to a certain size.
+struct ScaledPixmap final {
+  /// The size the texture was scaled to.
+  QSize size;
+  /// The scaled texture.
+  QPixmap pixmap;
+};
+
+/// Indicates the number of bytes taken by a pixmap.
+/// @param pixmap The pixmap to measure.
+/// @returns The size of the pixmap's pixel data.
+std::size_t get_pixmap_bytes(const QPixmap& pixmap) noexcept {
+  return ((std::size_t) pixmap.width())
+       * ((std::size_t) pixmap.height())
+       * ((std::size_t) pixmap.depth()) / 8;
+}
+
+/// A texture in the texture table.
+/// Only the path is kept until the texture is used.
+struct TextureEntry final {
+  /// The path to the texture file.
+  QString path;
+  /// The pixels of the texture, when it was opened from
+  /// pixels that were already decoded. This refers to the
+  /// pixels without copying them.
+  QImage image;
+  /// The decoded texture, which is null when
+  /// the texture isn't resident or failed to decode.
+  QPixmap pixmap;
+  /// The sizes the texture was scaled to while resident.
+  std::vector<ScaledPixmap> scaled;
+  /// The number of bytes taken by the pixmaps.
+  std::size_t bytes;
+  /// Whether or not the texture is decoded.
+  bool resident;
+  /// Whether or not the texture is being decoded by the thread pool.
+  bool decoding;
+  /// The position of the texture in the LRU list.
+  std::list<std::size_t>::iterator lru_pos;
+  /// Constructs a texture entry that isn't resident.
+  /// @param p The path to the texture file.
+  TextureEntry(const QString& p) : path(p), bytes(0), resident(false), decoding(false) {}
+  /// Constructs a texture entry from decoded pixels.
+  /// @param i The image referring to the pixels.
+  TextureEntry(const QImage& i) : image(i), bytes(0), resident(false), decoding(false) {}
+};
+
+/// A texture that was decoded by the thread pool.
+struct DecodedImage final {
+  /// The index of the texture.
+  std::size_t index;
+  /// The decoded image, which is null if decoding failed.
+  QImage image;
+};
+
+/// Passes decoded images from the
+/// thread pool to the texture table.
+class DecodeQueue final {
+  /// Guards the decoded images.
+  std::mutex mutex;
+  /// Signalled when an image is added.
+  std::condition_variable ready;
+  /// The images that haven't been taken yet.
+  std::vector<DecodedImage> images;
+public:
+  /// Adds a decoded image to the queue.
+  /// This is called from the thread pool.
+  void push(DecodedImage&& image) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      images.emplace_back(std::move(image));
+    }
+    ready.notify_one();
+  }
+  /// Takes all of the images in the queue.
+  /// @param out The vector to put the images into.
+  /// It's swapped with the queue, so it should be empty.
+  /// @param wait Whether or not to wait for an image,
+  /// if the queue is empty.
+  void take(std::vector<DecodedImage>& out, bool wait) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (wait) {
+      ready.wait(lock, [this] { return !images.empty(); });
+    }
+    out.swap(images);
+  }
+};
+
+/// Decodes one texture on the thread pool.
+class DecodeTask final : public QRunnable {
+  /// The queue to put the decoded image into.
+  DecodeQueue& queue;
+  /// The index of the texture.
+  std::size_t index;
+  /// The path to the texture.
+  QString path;
+public:
+  /// Constructs the decode task.
+  /// @param q The queue to put the decoded image into.
+  /// @param i The index of the texture.
+  /// @param p The path to the texture.
+  DecodeTask(DecodeQueue& q, std::size_t i, const QString& p)
+    : queue(q), index(i), path(p) {}
+  /// Decodes the texture.
+  void run() override {
+    ProfileScope scope("QtTextureTable::decode");
+    queue.push(DecodedImage { index, QImage(path) });
+  }
+};
+
 /// Implements the Qt texture table.
+/// Textures are only decoded when they're used or prefetched.
+/// The resident textures are kept in a least recently used list,
+/// which is trimmed from the back when the memory budget is exceeded.
 class QtTextureTableImpl final : public QtTextureTable {
-  /// The pixel maps for each loaded texture.
-  std::vector<QPixmap> pixmaps;
+  /// The textures in the table.
+  mutable std::vector<TextureEntry> entries;
+  /// The indices of the resident textures,
+  /// from most to least recently used.
+  mutable std::list<std::size_t> lru;
+  /// The memory usage of the table.
+  mutable TextureCacheStats stats;
+  /// The images decoded by the thread pool.
+  DecodeQueue decoded;
+  /// The images taken from the queue by @ref collect.
+  std::vector<DecodedImage> collected;
+  /// The number of prefetched textures that haven't been collected yet.
+  std::size_t pending_count;
+  /// The number of prefetched textures that have been collected
+  /// since the last time there were none pending.
+  std::size_t collected_count;
+  /// The threads decoding the textures. This is declared
+  /// last, so that it finishes its tasks before the queue
+  /// they write to is destroyed.
+  QThreadPool pool;
 public:
-  /// Opens a new texture.
+  /// Constructs an empty texture table.
+  QtTextureTableImpl() : pending_count(0), collected_count(0) {}
+  /// Opens a new texture. Only the path is
+  /// recorded until the texture is used.
   /// @param filename The path to the texture to open.
   void open(const char* filename) override {
-    pixmaps.emplace_back(filename);
+    entries.emplace_back(QString::fromUtf8(filename));
+  }
+  /// Opens a texture from decoded pixels. The pixels are
+  /// wrapped, not copied, and only turned into a pixmap when
+  /// the texture is used.
+  void open_pixels(const std::uint32_t* pixels, std::size_t width, std::size_t height) override {
+    entries.emplace_back(QImage((const uchar*) pixels,
+                                (int) width,
+                                (int) height,
+                                (int) (width * sizeof(std::uint32_t)),
+                                QImage::Format_ARGB32_Premultiplied));
+  }
+  /// Starts decoding a texture on the thread pool,
+  /// if it isn't resident or being decoded already.
+  void prefetch(Index index) override {
+
+    if (index >= entries.size()) {
+      return;
+    }
+
+    auto& entry = entries[index];
+
+    // Textures opened from pixels have nothing to decode.
+    if (entry.resident || entry.decoding || !entry.image.isNull()) {
+      return;
+    }
+
+    entry.decoding = true;
+
+    pending_count++;
+
+    pool.start(new DecodeTask(decoded, index, entry.path));
+  }
+  /// Collects all of the textures being prefetched.
+  void finish_loading(Observer* observer) override {
+
+    ProfileScope scope("QtTextureTable::finish_loading");
+
+    while (pending_count > 0) {
+
+      collect(true);
+
+      if (observer) {
+        observer->texture_loaded(collected_count, collected_count + pending_count);
+      }
+    }
+  }
+  /// Sets the number of bytes the resident textures may take.
+  void set_memory_budget(std::size_t bytes) override {
+    stats.memory_budget = bytes;
+    trim();
+  }
+  /// Accesses the memory usage of the table.
+  TextureCacheStats get_cache_stats() const override {
+    return stats;
+  }
+  /// Turns the prefetched images into pixmaps.
+  std::size_t collect(bool wait) override {
+
+    decoded.take(collected, wait && (pending_count > 0));
+
+    auto count = collected.size();
+
+    for (auto& image : collected) {
+
+      auto& entry = entries[image.index];
+
+      entry.decoding = false;
+
+      // The texture may have been used, and decoded
+      // on the spot, before the prefetch finished.
+      if (!entry.resident) {
+        make_resident(image.index, QPixmap::fromImage(std::move(image.image)));
+      }
+    }
+
+    collected.clear();
+
+    pending_count -= count;
+
+    collected_count = pending_count ? (collected_count + count) : 0;
+
+    trim();
+
+    return count;
   }
   /// Gets the pixmap for a texture at a specified index.
+  /// The texture is decoded if it isn't resident.
   /// @param index The index to get the texture of.
   /// @returns The pixmap at the specified location.
   QPixmap at(Index index) const override {
-    if (index >= pixmaps.size()) {
+
+    if (index >= entries.size()) {
+      return QPixmap();
+    }
+
+    use(index);
+
+    auto pixmap = entries[index].pixmap;
+
+    trim();
+
+    return pixmap;
+  }
+  /// Gets a scaled pixmap, scaling it only
+  /// if it hasn't been scaled to the size before.
+  QPixmap scaled(Index index, const QSize& size) const override {
+
+    if (index >= entries.size()) {
       return QPixmap();
-    } else {
-      return pixmaps.at(index);
+    }
+
+    use(index);
+
+    auto& entry = entries[index];
+
+    for (const auto& scaled_pixmap : entry.scaled) {
+      if (scaled_pixmap.size == size) {
+        return scaled_pixmap.pixmap;
+      }
+    }
+
+    if (entry.pixmap.isNull()) {
+      return entry.pixmap;
+    }
+
+    auto result = entry.pixmap.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    entry.scaled.emplace_back(ScaledPixmap { size, result });
+
+    add_bytes(entry, get_pixmap_bytes(result));
+
+    trim();
+
+    return result;
+  }
+  /// Releases the cached scaled pixmaps.
+  void clear_scaled() override {
+
+    for (auto& entry : entries) {
+
+      for (const auto& scaled_pixmap : entry.scaled) {
+        auto bytes = get_pixmap_bytes(scaled_pixmap.pixmap);
+        entry.bytes -= bytes;
+        stats.resident_bytes -= bytes;
+      }
+
+      entry.scaled.clear();
     }
   }
   /// Indicates the number of textures in the table.
   std::size_t size() const noexcept override {
-    return pixmaps.size();
+    return entries.size();
+  }
+protected:
+  /// Marks a texture as the most recently used,
+  /// decoding it first if it isn't resident.
+  /// @param index The index of the texture, which must be in bounds.
+  void use(std::size_t index) const {
+
+    auto& entry = entries[index];
+
+    if (entry.resident) {
+      stats.hit_count++;
+      lru.splice(lru.begin(), lru, entry.lru_pos);
+    } else {
+      stats.miss_count++;
+      ProfileScope scope("QtTextureTable::decode_on_use");
+      make_resident(index, entry.image.isNull() ? QPixmap(entry.path) : QPixmap::fromImage(entry.image));
+    }
+  }
+  /// Stores the decoded pixmap of a texture and
+  /// places the texture at the front of the LRU list.
+  /// A pixmap that failed to decode is kept as well,
+  /// so that the file isn't read again on every use.
+  /// @param index The index of the texture.
+  /// @param pixmap The decoded pixmap.
+  void make_resident(std::size_t index, QPixmap&& pixmap) const {
+
+    auto& entry = entries[index];
+
+    entry.pixmap = std::move(pixmap);
+    entry.resident = true;
+    entry.lru_pos = lru.insert(lru.begin(), index);
+
+    add_bytes(entry, get_pixmap_bytes(entry.pixmap));
+  }
+  /// Accounts for memory taken by a texture.
+  void add_bytes(TextureEntry& entry, std::size_t bytes) const noexcept {
+    entry.bytes += bytes;
+    stats.resident_bytes += bytes;
+  }
+  /// Releases the least recently used textures until the
+  /// resident textures fit the budget. The most recently used
+  /// texture is always kept, even if it doesn't fit by itself.
+  void trim() const {
+
+    if (!stats.memory_budget) {
+      return;
+    }
+
+    while ((stats.resident_bytes > stats.memory_budget) && (lru.size() > 1)) {
+
+      auto& entry = entries[lru.back()];
+
+      lru.pop_back();
+
+      stats.resident_bytes -= entry.bytes;
+      stats.eviction_count++;
+
+      entry.pixmap = QPixmap();
+      entry.scaled.clear();
+      entry.bytes = 0;
+      entry.resident = false;
+    }
   }
 };
 
@@ -2,7 +2,10 @@
 
 #include <herald/TextureTable.h>
 
+#include <cstddef>
+
 class QPixmap;
+class QSize;
 
 namespace herald {
 
@@ -12,6 +15,12 @@ class ScopedPtr;
 class Index;
 
 /// The Qt interface of the texture table.
+/// Textures are decoded the first time they're used, or
+/// ahead of time on a thread pool when they're prefetched.
+/// Prefetched images are turned into pixmaps on the thread
+/// that owns the table when they're collected. The least
+/// recently used textures are released when the table
+/// goes over its memory budget.
 class QtTextureTable : public TextureTable {
 public:
   /// Creates a new texture table.
@@ -23,6 +32,25 @@ public:
   /// @param index The index of the texture to access.
   /// @returns The pixmap for the specified texture.
   virtual QPixmap at(Index index) const = 0;
+  /// Gets the pixmap for a texture, scaled to a certain size.
+  /// Scaled pixmaps are cached, so that each texture is only
+  /// scaled once for every size it's displayed at.
+  /// @param index The index of the texture to access.
+  /// @param size The size to scale the texture to.
+  /// @returns The scaled pixmap, or a null pixmap
+  /// if the index is out of bounds.
+  virtual QPixmap scaled(Index index, const QSize& size) const = 0;
+  /// Releases all of the cached scaled pixmaps.
+  /// This should be done when the display size changes,
+  /// since the pixmaps of the old size won't be used anymore.
+  virtual void clear_scaled() = 0;
+  /// Turns the prefetched textures that finished decoding into pixmaps.
+  /// This must be called from the thread that owns the table.
+  /// @param wait Whether or not to wait for a texture to finish
+  /// decoding, if none have yet. If no textures are being decoded,
+  /// then this doesn't wait.
+  /// @returns The number of textures that were collected.
+  virtual std::size_t collect(bool wait) = 0;
 };
 
 } // namespace herald
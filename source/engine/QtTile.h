@@ -1,44 +1,51 @@
 #pragma once
 
+#include <herald/Index.h>
 #include <herald/Tile.h>
 
 #include <cstddef>
 
-class QGraphicsItem;
-class QRectF;
-
 namespace herald {
 
-template <typename T>
-class ScopedPtr;
-
 class AnimationTable;
-class QtTextureTable;
 
 /// The Qt version of the tile instance.
-class QtTile : public Tile {
+/// Tiles don't have graphics items of their own.
+/// They're painted by the room, which keeps them
+/// by value, so they're kept as small as possible.
+class QtTile final : public Tile {
+  /// The index of the texture the tile is displaying.
+  Index texture_index;
+  /// Whether or not the tile has to be repainted.
+  bool dirty;
 public:
-  /// Creates a new Qt tile.
-  /// @param parent A pointer to the parent graphics item.
-  /// @returns A new Qt tile instance.
-  static ScopedPtr<QtTile> make(QGraphicsItem* parent);
-  /// Just a stub.
-  virtual ~QtTile() {}
-  /// Gets a pointer to the graphics item for this tile.
-  /// @returns A pointer to the graphics item.
-  virtual QGraphicsItem* get_graphics_item() = 0;
-  /// Sets the rectangle shape of the tile.
-  /// @param rect The rectangle shape to assign.
-  virtual void set_rect(const QRectF& rect) = 0;
+  /// Constructs a new tile.
+  /// New tiles have to be painted.
+  constexpr QtTile() noexcept : dirty(true) {}
+  using Tile::get_animation_index;
+  /// Accesses the index of the texture displayed by the tile.
+  inline Index get_texture_index() const noexcept {
+    return texture_index;
+  }
+  /// Indicates whether or not the tile has to be repainted.
+  inline bool is_dirty() const noexcept {
+    return dirty;
+  }
+  /// Marks the tile as having to be repainted.
+  inline void mark_dirty() noexcept {
+    dirty = true;
+  }
+  /// Marks the tile as painted.
+  inline void mark_clean() noexcept {
+    dirty = false;
+  }
   /// Updates the texture index used for the tile.
+  /// If the index changes, the tile is marked dirty.
   /// @param ellapsed_ms The updated timeline duration.
   /// @param animations A reference to the animation
   /// table to get the texture index from.
   /// @returns True if the texture index changed, false otherwise.
-  virtual bool update_texture_index(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
-  /// Updates the texture displayed for the tile.
-  /// @param textures The table to get the texture data from.
-  virtual void update_texture(const QtTextureTable& textures) = 0;
+  bool update_texture_index(std::size_t ellapsed_ms, const AnimationTable& animations);
 };
 
 } // namespace herald
@@ -0,0 +1,261 @@
+#include "TileScheduler.h"
+
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/ScopedPtr.h>
+
+#include <vector>
+
+namespace herald {
+
+namespace {
+
+/// The number of slots in the timing wheel.
+/// Each slot covers one millisecond.
+const std::size_t wheel_size = 256;
+
+/// An animation that was put on the timing wheel.
+struct Deadline final {
+  /// The point in time that the animation changes frames.
+  std::size_t time_ms;
+  /// The index of the animation.
+  std::size_t animation;
+};
+
+/// The tiles that use one animation.
+struct AnimationGroup final {
+  /// The indices of the tiles.
+  std::vector<std::size_t> tiles;
+  /// The point in time that the animation is on the
+  /// timing wheel for, or SIZE_MAX if it isn't on it.
+  std::size_t deadline_ms;
+  /// Constructs an empty group.
+  AnimationGroup() : deadline_ms(SIZE_MAX) {}
+};
+
+/// The implementation of the tile scheduler.
+class TileSchedulerImpl final : public TileScheduler {
+  /// The timing wheel. Each slot has the deadlines whose
+  /// times are equal to the slot index, modulo the wheel size.
+  /// A deadline is only valid if its animation group still
+  /// has the same deadline time.
+  std::vector<std::vector<Deadline>> wheel;
+  /// The tiles of each animation in the table.
+  std::vector<AnimationGroup> groups;
+  /// The animation index of each tile.
+  std::vector<std::size_t> tile_animations;
+  /// The position of each tile within its animation group.
+  std::vector<std::size_t> tile_positions;
+  /// The tiles to wake up on the next advance,
+  /// because their animation was changed.
+  std::vector<std::size_t> pending_tiles;
+  /// The animations to put on the wheel on the
+  /// next advance, because they gained tiles.
+  std::vector<std::size_t> pending_animations;
+  /// The tiles woken up by the last advance.
+  std::vector<std::size_t> woken_tiles;
+  /// The point in time of the last advance.
+  std::size_t now_ms;
+  /// Whether or not all tiles have to be woken
+  /// up on the next advance.
+  bool wake_all;
+public:
+  /// Constructs an empty scheduler.
+  TileSchedulerImpl() : wheel(wheel_size), now_ms(0), wake_all(true) {}
+  /// Resizes the number of tiles.
+  void resize(std::size_t tile_count) override {
+    tile_animations.assign(tile_count, SIZE_MAX);
+    tile_positions.assign(tile_count, 0);
+    for (auto& group : groups) {
+      group.tiles.clear();
+    }
+    pending_tiles.clear();
+    wake_all = true;
+  }
+  /// Assigns the animation of a tile.
+  void assign(std::size_t tile, Index animation) override {
+
+    if ((tile >= tile_animations.size())
+     || (tile_animations[tile] == animation)) {
+      return;
+    }
+
+    remove_from_group(tile);
+
+    tile_animations[tile] = animation;
+
+    add_to_group(tile);
+
+    pending_tiles.push_back(tile);
+  }
+  /// Moves time forward, waking up the tiles
+  /// whose animations have changed frames.
+  std::size_t advance(std::size_t ellapsed_ms, const AnimationTable& animations) override {
+
+    woken_tiles.clear();
+
+    if (wake_all
+     || (ellapsed_ms < now_ms)
+     || (animations.size() != groups.size())) {
+      reset(ellapsed_ms, animations);
+      return woken_tiles.size();
+    }
+
+    woken_tiles.swap(pending_tiles);
+
+    // If a whole turn of the wheel has passed, every slot is due.
+    auto passed_ms = ellapsed_ms - now_ms;
+    auto slot_count = (passed_ms < wheel_size) ? passed_ms : wheel_size;
+
+    for (std::size_t i = 1; i <= slot_count; i++) {
+      expire(wheel[(now_ms + i) % wheel_size], ellapsed_ms);
+    }
+
+    now_ms = ellapsed_ms;
+
+    for (auto animation : pending_animations) {
+      schedule(animation, animations);
+    }
+
+    pending_animations.clear();
+
+    return woken_tiles.size();
+  }
+  /// Accesses the tiles woken up by the last advance.
+  const std::size_t* get_woken_tiles() const noexcept override {
+    return woken_tiles.data();
+  }
+protected:
+  /// Adds a tile to the group of its animation.
+  /// If the group was empty, then it's scheduled.
+  void add_to_group(std::size_t tile) {
+
+    auto animation = tile_animations[tile];
+    if (animation >= groups.size()) {
+      return;
+    }
+
+    auto& group = groups[animation];
+
+    if (group.tiles.empty()) {
+      pending_animations.push_back(animation);
+    }
+
+    tile_positions[tile] = group.tiles.size();
+
+    group.tiles.push_back(tile);
+  }
+  /// Removes a tile from the group of its animation.
+  void remove_from_group(std::size_t tile) {
+
+    auto animation = tile_animations[tile];
+    if (animation >= groups.size()) {
+      return;
+    }
+
+    auto& tiles = groups[animation].tiles;
+
+    auto position = tile_positions[tile];
+
+    tiles[position] = tiles.back();
+
+    tile_positions[tiles[position]] = position;
+
+    tiles.pop_back();
+  }
+  /// Wakes up the animations in a slot of the timing wheel
+  /// whose deadlines have passed. Deadlines that are one or
+  /// more turns of the wheel away are left in the slot.
+  /// @param slot The slot of the timing wheel.
+  /// @param ellapsed_ms The new point in time.
+  void expire(std::vector<Deadline>& slot, std::size_t ellapsed_ms) {
+
+    std::size_t i = 0;
+
+    while (i < slot.size()) {
+
+      auto deadline = slot[i];
+
+      if (deadline.time_ms > ellapsed_ms) {
+        i++;
+        continue;
+      }
+
+      slot[i] = slot.back();
+      slot.pop_back();
+
+      auto& group = groups[deadline.animation];
+
+      if (group.deadline_ms != deadline.time_ms) {
+        continue;
+      }
+
+      group.deadline_ms = SIZE_MAX;
+
+      woken_tiles.insert(woken_tiles.end(), group.tiles.begin(), group.tiles.end());
+
+      pending_animations.push_back(deadline.animation);
+    }
+  }
+  /// Puts an animation on the timing wheel, at the next time
+  /// it changes frames. Animations without tiles, without
+  /// more than one frame, or that are already on the wheel
+  /// are left alone.
+  void schedule(std::size_t animation, const AnimationTable& animations) {
+
+    auto& group = groups[animation];
+
+    if (group.tiles.empty() || (group.deadline_ms != SIZE_MAX)) {
+      return;
+    }
+
+    auto next_ms = animations.at(animation)->calculate_next_change(now_ms);
+    if (next_ms == SIZE_MAX) {
+      return;
+    }
+
+    group.deadline_ms = next_ms;
+
+    wheel[next_ms % wheel_size].push_back(Deadline { next_ms, animation });
+  }
+  /// Rebuilds the animation groups and the timing wheel,
+  /// and wakes up all of the tiles.
+  /// @param ellapsed_ms The new point in time.
+  /// @param animations The animation table used by the tiles.
+  void reset(std::size_t ellapsed_ms, const AnimationTable& animations) {
+
+    for (auto& slot : wheel) {
+      slot.clear();
+    }
+
+    groups.clear();
+    groups.resize(animations.size());
+
+    pending_tiles.clear();
+    pending_animations.clear();
+
+    for (std::size_t i = 0; i < tile_animations.size(); i++) {
+      add_to_group(i);
+      woken_tiles.push_back(i);
+    }
+
+    pending_animations.clear();
+
+    now_ms = ellapsed_ms;
+
+    for (std::size_t i = 0; i < groups.size(); i++) {
+      schedule(i, animations);
+    }
+
+    wake_all = false;
+  }
+};
+
+} // namespace
+
+ScopedPtr<TileScheduler> TileScheduler::make() {
+  return new TileSchedulerImpl();
+}
+
+} // namespace herald
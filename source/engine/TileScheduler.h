@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+class AnimationTable;
+class Index;
+
+/// Decides which tiles of a room have to be updated
+/// as time moves forward. The tiles are grouped by the
+/// animation they use, and each animation is put on a
+/// timing wheel at the point in time that its next frame
+/// starts. When time passes that point, only the tiles of
+/// that animation are woken up. Tiles with still frames
+/// are never woken up, except when they're assigned a
+/// new animation or the animation table changes.
+class TileScheduler {
+public:
+  /// Creates a new tile scheduler.
+  /// @returns A new tile scheduler instance.
+  static ScopedPtr<TileScheduler> make();
+  /// Just a stub.
+  virtual ~TileScheduler() {}
+  /// Resizes the number of tiles being scheduled.
+  /// All tiles are left without an animation, and
+  /// all of them are woken up on the next advance.
+  /// @param tile_count The number of tiles in the room.
+  virtual void resize(std::size_t tile_count) = 0;
+  /// Assigns the animation of a tile. If the animation
+  /// changes, the tile is woken up on the next advance.
+  /// @param tile The index of the tile.
+  /// @param animation The index of the animation used by the tile.
+  virtual void assign(std::size_t tile, Index animation) = 0;
+  /// Moves time forward and finds the tiles that have to
+  /// be updated. Moving time backwards, or changing the
+  /// number of animations in the table, wakes up all tiles.
+  /// @param ellapsed_ms The new total number of ellapsed milliseconds.
+  /// @param animations The animation table used by the tiles.
+  /// @returns The number of tiles that were woken up.
+  virtual std::size_t advance(std::size_t ellapsed_ms, const AnimationTable& animations) = 0;
+  /// Accesses the tiles woken up by the last advance.
+  /// A tile may appear more than once.
+  virtual const std::size_t* get_woken_tiles() const noexcept = 0;
+};
+
+} // namespace herald
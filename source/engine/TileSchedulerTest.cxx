@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <herald/Animation.h>
+#include <herald/AnimationTable.h>
+#include <herald/Index.h>
+#include <herald/ScopedPtr.h>
+
+#include "TileScheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace herald;
+
+namespace {
+
+/// Advances a scheduler and gets the
+/// woken tiles, in order and without duplicates.
+std::vector<std::size_t> advance(TileScheduler& scheduler,
+                                 std::size_t ellapsed_ms,
+                                 const AnimationTable& animations) {
+
+  auto count = scheduler.advance(ellapsed_ms, animations);
+
+  const auto* woken = scheduler.get_woken_tiles();
+
+  std::vector<std::size_t> tiles(woken, woken + count);
+
+  std::sort(tiles.begin(), tiles.end());
+
+  tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+
+  return tiles;
+}
+
+/// Makes a table with a still frame
+/// animation and a 100ms blinking animation.
+ScopedPtr<AnimationTable> make_animations() {
+
+  auto animations = AnimationTable::make();
+
+  animations->add_still_frame(Index(0));
+
+  auto blinking = Animation::make();
+  blinking->add_frame(Index(1), 100);
+  blinking->add_frame(Index(2), 100);
+  animations->add(std::move(blinking));
+
+  return animations;
+}
+
+} // namespace
+
+TEST(TileScheduler, WakesChangedTiles) {
+
+  auto animations = make_animations();
+
+  auto scheduler = TileScheduler::make();
+
+  scheduler->resize(4);
+  scheduler->assign(0, Index(0));
+  scheduler->assign(1, Index(1));
+  scheduler->assign(2, Index(0));
+  scheduler->assign(3, Index(1));
+
+  // Everything is woken up the first time.
+  EXPECT_EQ(advance(*scheduler, 0, *animations).size(), 4);
+
+  EXPECT_EQ(advance(*scheduler, 50, *animations).size(), 0);
+
+  auto woken = advance(*scheduler, 100, *animations);
+  EXPECT_EQ(woken, (std::vector<std::size_t> { 1, 3 }));
+
+  EXPECT_EQ(advance(*scheduler, 150, *animations).size(), 0);
+
+  // Skipping over more than one turn of the wheel.
+  woken = advance(*scheduler, 1000, *animations);
+  EXPECT_EQ(woken, (std::vector<std::size_t> { 1, 3 }));
+}
+
+TEST(TileScheduler, Assign) {
+
+  auto animations = make_animations();
+
+  auto scheduler = TileScheduler::make();
+
+  scheduler->resize(3);
+
+  advance(*scheduler, 0, *animations);
+
+  scheduler->assign(2, Index(1));
+
+  auto woken = advance(*scheduler, 10, *animations);
+  EXPECT_EQ(woken, (std::vector<std::size_t> { 2 }));
+
+  woken = advance(*scheduler, 100, *animations);
+  EXPECT_EQ(woken, (std::vector<std::size_t> { 2 }));
+
+  scheduler->assign(2, Index(0));
+
+  woken = advance(*scheduler, 110, *animations);
+  EXPECT_EQ(woken, (std::vector<std::size_t> { 2 }));
+
+  EXPECT_EQ(advance(*scheduler, 200, *animations).size(), 0);
+}
+
+TEST(TileScheduler, WakeAll) {
+
+  auto animations = make_animations();
+
+  auto scheduler = TileScheduler::make();
+
+  scheduler->resize(2);
+  scheduler->assign(0, Index(2));
+
+  EXPECT_EQ(advance(*scheduler, 0, *animations).size(), 2);
+
+  EXPECT_EQ(advance(*scheduler, 0, *animations).size(), 0);
+
+  animations->add_still_frame(Index(5));
+
+  // The animation table changed.
+  EXPECT_EQ(advance(*scheduler, 10, *animations).size(), 2);
+
+  // Going back in time.
+  EXPECT_EQ(advance(*scheduler, 5, *animations).size(), 2);
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace herald {
 
 template <typename T>
@@ -28,6 +30,8 @@ public:
   virtual const Action* at(Index index) const noexcept = 0;
   /// Remove all actions from the table.
   virtual void clear() = 0;
+  /// Indicates the number of actions in the table.
+  virtual std::size_t size() const noexcept = 0;
 };
 
 } // namespace herald
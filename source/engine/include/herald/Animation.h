@@ -28,10 +28,27 @@ public:
   /// @param texture The index of the texture to add.
   /// @param duration The duration of the frame, in terms of milliseconds.
   virtual void add_frame(Index texture, std::size_t duration) = 0;
+  /// Reserves space for a number of frames,
+  /// when the number is known ahead of time.
+  /// @param frame_count The number of frames to reserve space for.
+  virtual void reserve(std::size_t frame_count) = 0;
   /// Calculates the texture index for a certain point in time.
   /// @param ellapsed_ms The point in time to get the texture index for.
   /// @returns The texture index at the specified point in time.
   virtual Index calculate_texture_index(std::size_t ellapsed_ms) const noexcept = 0;
+  /// Calculates when the animation next changes frames.
+  /// @param ellapsed_ms The current point in time.
+  /// @returns The point in time, after @p ellapsed_ms, at which
+  /// the next frame starts. If the animation never changes frames,
+  /// then SIZE_MAX is returned.
+  virtual std::size_t calculate_next_change(std::size_t ellapsed_ms) const noexcept = 0;
+  /// Indicates the number of frames in the animation.
+  virtual std::size_t get_frame_count() const noexcept = 0;
+  /// Accesses the texture of a frame.
+  /// @param frame The index of the frame.
+  /// @returns The texture index of the frame, or an
+  /// invalid index if the frame is out of bounds.
+  virtual Index get_frame_texture(std::size_t frame) const noexcept = 0;
 };
 
 } // namespace herald
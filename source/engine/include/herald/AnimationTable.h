@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace herald {
 
 template <typename T>
@@ -28,6 +30,18 @@ public:
   /// If the index it out of bounds, then a pointer
   /// to a null animation instance is returned instead.
   virtual const Animation* at(Index index) const noexcept = 0;
+  /// Indicates the number of animations in the table.
+  virtual std::size_t size() const noexcept = 0;
+  /// Calculates the texture index of an animation at a point in time.
+  /// The results are cached for the most recent point in time, so
+  /// that every tile and object sharing an animation during a tick
+  /// reuses one result instead of calculating it again.
+  /// @param index The index of the animation.
+  /// @param ellapsed_ms The point in time to get the texture index for.
+  /// @returns The texture index of the animation at the specified
+  /// point in time. If the animation index is out of bounds, then
+  /// an invalid index is returned.
+  virtual Index calculate_texture_index(Index index, std::size_t ellapsed_ms) const noexcept = 0;
 };
 
 } // namespace herald
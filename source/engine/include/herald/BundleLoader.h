@@ -0,0 +1,17 @@
+#pragma once
+
+namespace herald {
+
+class BundleReader;
+class Model;
+
+/// Loads the actions, animations and textures of a bundle into a model.
+/// The textures refer to the pixels in the bundle, so the bundle's memory
+/// has to stay valid for as long as the model exists.
+/// @param model The model to put the data into.
+/// @param bundle The bundle to get the data from.
+/// @returns True on success, false if the model doesn't have a table
+/// to put some of the data into.
+bool load_bundle_model(Model* model, const BundleReader& bundle);
+
+} // namespace herald
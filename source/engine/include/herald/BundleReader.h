@@ -0,0 +1,85 @@
+#pragma once
+
+#include <herald/Index.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace herald {
+
+struct BundleAnimation;
+struct BundleFrame;
+struct BundleTexture;
+
+/// Reads a game bundle that's already in memory, usually
+/// by mapping the bundle file. Nothing is copied out of the
+/// bundle, so the memory has to stay valid for as long as the
+/// reader, or anything given the texture pixels, is in use.
+class BundleReader final {
+  /// The animation index of every action.
+  const std::uint32_t* actions;
+  /// The frame range of every animation.
+  const BundleAnimation* animations;
+  /// The frames of all the animations.
+  const BundleFrame* frames;
+  /// The size and location of every texture.
+  const BundleTexture* textures;
+  /// The start of the bundle.
+  const unsigned char* base;
+  /// The number of actions.
+  std::size_t action_count;
+  /// The number of animations.
+  std::size_t animation_count;
+  /// The number of textures.
+  std::size_t texture_count;
+public:
+  /// Constructs an empty bundle reader.
+  BundleReader() noexcept;
+  /// Opens a bundle. Every table and texture is checked to be
+  /// within the bundle, so that the accessors don't have to.
+  /// @param data The start of the bundle. This must be aligned
+  /// to at least 8 bytes, which mapped files always are.
+  /// @param size The number of bytes in the bundle.
+  /// @returns True on success, false if the bundle isn't valid.
+  /// On failure, the reader is left empty.
+  bool open(const void* data, std::size_t size) noexcept;
+  /// Indicates the number of actions in the bundle.
+  inline std::size_t get_action_count() const noexcept {
+    return action_count;
+  }
+  /// Accesses the animation index of an action.
+  /// @param action The index of the action, which must be in bounds.
+  Index get_action_animation(std::size_t action) const noexcept;
+  /// Indicates the number of animations in the bundle.
+  inline std::size_t get_animation_count() const noexcept {
+    return animation_count;
+  }
+  /// Indicates the number of frames in an animation.
+  /// @param animation The index of the animation, which must be in bounds.
+  std::size_t get_frame_count(std::size_t animation) const noexcept;
+  /// Accesses the texture of an animation frame.
+  /// @param animation The index of the animation, which must be in bounds.
+  /// @param frame The index of the frame, which must be in bounds.
+  Index get_frame_texture(std::size_t animation, std::size_t frame) const noexcept;
+  /// Accesses the delay of an animation frame, in milliseconds.
+  /// A frame that lasts forever has a delay of SIZE_MAX.
+  /// @param animation The index of the animation, which must be in bounds.
+  /// @param frame The index of the frame, which must be in bounds.
+  std::size_t get_frame_delay(std::size_t animation, std::size_t frame) const noexcept;
+  /// Indicates the number of textures in the bundle.
+  inline std::size_t get_texture_count() const noexcept {
+    return texture_count;
+  }
+  /// Accesses the width of a texture, in pixels.
+  /// @param texture The index of the texture, which must be in bounds.
+  std::size_t get_texture_width(std::size_t texture) const noexcept;
+  /// Accesses the height of a texture, in pixels.
+  /// @param texture The index of the texture, which must be in bounds.
+  std::size_t get_texture_height(std::size_t texture) const noexcept;
+  /// Accesses the pixels of a texture. These are premultiplied
+  /// ARGB words, one row after the other, without padding.
+  /// @param texture The index of the texture, which must be in bounds.
+  const std::uint32_t* get_texture_pixels(std::size_t texture) const noexcept;
+};
+
+} // namespace herald
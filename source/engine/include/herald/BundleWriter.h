@@ -0,0 +1,55 @@
+#pragma once
+
+#include <herald/Index.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace herald {
+
+/// Builds a game bundle, which can then
+/// be read with a @ref BundleReader.
+class BundleWriter final {
+  /// The animation index of every action.
+  std::vector<std::uint32_t> actions;
+  /// The index of the first frame of every animation.
+  std::vector<std::size_t> animation_starts;
+  /// The texture and delay of every frame,
+  /// two values per frame.
+  std::vector<std::uint32_t> frames;
+  /// The width and height of every texture,
+  /// two values per texture.
+  std::vector<std::uint32_t> texture_sizes;
+  /// The pixels of every texture.
+  std::vector<std::vector<std::uint32_t>> texture_pixels;
+public:
+  /// Adds an action to the bundle.
+  /// @param animation The index of the action's animation.
+  void add_action(Index animation);
+  /// Adds an empty animation to the bundle.
+  /// Frames are added to it with @ref add_frame.
+  void add_animation();
+  /// Adds a frame to the last animation.
+  /// If there are no animations, then one is added first.
+  /// @param texture The index of the texture to display.
+  /// @param delay_ms The number of milliseconds the frame lasts.
+  /// Delays that don't fit in 32 bits, such as SIZE_MAX, are read
+  /// back as SIZE_MAX.
+  void add_frame(Index texture, std::size_t delay_ms);
+  /// Adds a texture to the bundle.
+  /// @param width The width of the texture, in pixels.
+  /// @param height The height of the texture, in pixels.
+  /// @param pixels The premultiplied ARGB pixels of the
+  /// texture, one row after the other, without padding.
+  void add_texture(std::size_t width, std::size_t height, const std::uint32_t* pixels);
+  /// Indicates the number of textures added so far.
+  inline std::size_t get_texture_count() const noexcept {
+    return texture_pixels.size();
+  }
+  /// Lays out the bundle.
+  /// @returns The contents of the bundle file.
+  std::vector<unsigned char> build() const;
+};
+
+} // namespace herald
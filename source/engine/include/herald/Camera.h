@@ -0,0 +1,119 @@
+#pragma once
+
+#include <herald/Vec2f.h>
+
+#include <cstddef>
+
+namespace herald {
+
+/// A rectangular range of tiles.
+/// The maximum coordinates are exclusive.
+struct TileRange final {
+  /// The first column in the range.
+  std::size_t x_min;
+  /// The first row in the range.
+  std::size_t y_min;
+  /// One past the last column in the range.
+  std::size_t x_max;
+  /// One past the last row in the range.
+  std::size_t y_max;
+  /// Indicates whether or not a tile is within the range.
+  inline bool contains(std::size_t x, std::size_t y) const noexcept {
+    return (x >= x_min) && (x < x_max)
+        && (y >= y_min) && (y < y_max);
+  }
+  /// Indicates whether or not any part of a one tile
+  /// object, such as a game object, is within the range.
+  /// @param pos The position of the object, in tiles.
+  inline bool overlaps(const Vec2f& pos) const noexcept {
+    return ((pos.x() + 1) > x_min) && (pos.x() < x_max)
+        && ((pos.y() + 1) > y_min) && (pos.y() < y_max);
+  }
+  /// Indicates the number of tiles in the range.
+  inline std::size_t size() const noexcept {
+    return (x_max - x_min) * (y_max - y_min);
+  }
+  /// Compares two ranges.
+  inline bool operator == (const TileRange& other) const noexcept {
+    return (x_min == other.x_min) && (y_min == other.y_min)
+        && (x_max == other.x_max) && (y_max == other.y_max);
+  }
+  /// Compares two ranges.
+  inline bool operator != (const TileRange& other) const noexcept {
+    return !(*this == other);
+  }
+};
+
+/// Decides the part of the room that is seen.
+/// By default, the whole room is fit into the view.
+/// Once the camera is given a tile size, the tiles
+/// are drawn at that size instead and the view is
+/// centered on the position of the camera.
+class Camera final {
+  /// The point that the view is centered on, in tiles.
+  Vec2f position;
+  /// The size of a tile on the screen, in pixels.
+  /// Zero means that the room is fit into the view.
+  std::size_t tile_size;
+public:
+  /// Constructs a camera that fits the room into the view.
+  constexpr Camera() noexcept : tile_size(0) {}
+  /// Moves the camera.
+  /// @param pos The point to center the view on, in tiles.
+  inline void set_position(const Vec2f& pos) noexcept {
+    position = pos;
+  }
+  /// Sets the size of a tile on the screen.
+  /// @param size The tile size, in pixels.
+  /// Zero fits the room into the view.
+  inline void set_tile_size(std::size_t size) noexcept {
+    tile_size = size;
+  }
+  /// Accesses the point the view is centered on.
+  inline const Vec2f& get_position() const noexcept {
+    return position;
+  }
+  /// Accesses the size of a tile on the screen.
+  inline std::size_t get_tile_size() const noexcept {
+    return tile_size;
+  }
+  /// Indicates whether or not the room is fit into the view.
+  inline bool fits_room() const noexcept {
+    return tile_size == 0;
+  }
+  /// Calculates the point of the room, in pixels, that
+  /// is at the top left corner of the view.
+  /// @param view_w The width of the view, in pixels.
+  /// @param view_h The height of the view, in pixels.
+  /// @returns The top left corner of the view. When the room
+  /// is fit into the view, this is always the origin.
+  Vec2f calculate_origin(std::size_t view_w, std::size_t view_h) const noexcept;
+  /// Calculates the range of tiles that can be seen.
+  /// @param view_w The width of the view, in pixels.
+  /// @param view_h The height of the view, in pixels.
+  /// @param room_w The width of the room, in tiles.
+  /// @param room_h The height of the room, in tiles.
+  /// @param margin The number of tiles to add around each
+  /// side of the view, so that tiles just off screen are
+  /// kept up to date as the camera moves.
+  /// @returns The range of visible tiles, which is
+  /// clipped to the room. When the room is fit into
+  /// the view, this is the whole room.
+  TileRange calculate_visible_tiles(std::size_t view_w,
+                                    std::size_t view_h,
+                                    std::size_t room_w,
+                                    std::size_t room_h,
+                                    std::size_t margin) const noexcept;
+  /// Compares two cameras.
+  inline bool operator == (const Camera& other) const noexcept {
+    return (position.x() == other.position.x())
+        && (position.y() == other.position.y())
+        && (tile_size == other.tile_size);
+  }
+  /// Compares two cameras.
+  inline bool operator != (const Camera& other) const noexcept {
+    return !(*this == other);
+  }
+};
+
+} // namespace herald
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+
+namespace herald {
+
+/// Converts variable amounts of real time into a
+/// number of fixed-length simulation steps. Time that
+/// doesn't add up to a whole step is carried over to
+/// the next call, so the simulation never drifts from
+/// the real time it's given.
+class FixedStepClock final {
+  /// The length of one step, in milliseconds.
+  std::size_t step_ms;
+  /// The most steps that may be taken at once.
+  /// Zero means there is no limit.
+  std::size_t max_steps;
+  /// The time that hasn't been turned into a step yet.
+  std::size_t pending_ms;
+  /// The total time covered by the steps taken so far.
+  std::size_t ellapsed_ms;
+  /// The total time that was dropped because
+  /// the step limit was exceeded.
+  std::size_t dropped_ms;
+public:
+  /// Constructs a new clock.
+  /// @param step_ms_ The length of one step, in milliseconds.
+  /// A length of zero is treated as one millisecond.
+  /// @param max_steps_ The most steps that may be taken by one
+  /// call to @ref advance. When more time than that arrives at
+  /// once, the extra time is dropped instead of being caught up
+  /// on. Zero means that all the time is always caught up on.
+  FixedStepClock(std::size_t step_ms_ = 16, std::size_t max_steps_ = 0) noexcept;
+  /// Adds real time to the clock.
+  /// @param delta_ms The number of milliseconds that have passed.
+  /// @returns The number of steps that should be taken.
+  std::size_t advance(std::size_t delta_ms) noexcept;
+  /// Resets the clock to zero.
+  void reset() noexcept;
+  /// Accesses the length of one step, in milliseconds.
+  inline std::size_t get_step_ms() const noexcept {
+    return step_ms;
+  }
+  /// Accesses the time covered by the steps taken so far.
+  inline std::size_t get_ellapsed_ms() const noexcept {
+    return ellapsed_ms;
+  }
+  /// Accesses the time that hasn't made up a full step yet.
+  inline std::size_t get_pending_ms() const noexcept {
+    return pending_ms;
+  }
+  /// Accesses the total time dropped by the step limit.
+  inline std::size_t get_dropped_ms() const noexcept {
+    return dropped_ms;
+  }
+};
+
+} // namespace herald
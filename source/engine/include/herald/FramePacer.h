@@ -0,0 +1,63 @@
+#pragma once
+
+#include <herald/FixedStepClock.h>
+#include <herald/FrameStats.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace herald {
+
+/// Drives a frame loop from a monotonic clock.
+/// Each frame, the pacer is given the current time and
+/// it works out how many fixed simulation steps have to
+/// be taken to keep the game in line with real time.
+/// Time is measured in nanoseconds, so that the parts
+/// of a millisecond that a timer overshoots by aren't lost.
+class FramePacer final {
+  /// Turns the measured time into simulation steps.
+  FixedStepClock clock;
+  /// The time of the last frame.
+  std::uint64_t last_frame_ns;
+  /// The part of the measured time that
+  /// doesn't make up a whole millisecond yet.
+  std::uint64_t remainder_ns;
+  /// Whether or not the pacer was started.
+  bool started;
+  /// The statistics on the frame times.
+  FrameStats stats;
+public:
+  /// Constructs a new frame pacer.
+  /// @param frame_rate The number of steps to take per second.
+  /// A rate of zero is treated as one step per second.
+  /// @param max_catch_up The most steps that may be taken in one
+  /// frame. When a frame runs later than that, the extra time is
+  /// dropped instead of making the next frame even longer.
+  FramePacer(std::size_t frame_rate = 30, std::size_t max_catch_up = 4) noexcept;
+  /// Changes the frame rate. This resets the clock.
+  /// @param frame_rate The number of steps to take per second.
+  /// @param max_catch_up The most steps that may be taken in one frame.
+  void set_frame_rate(std::size_t frame_rate, std::size_t max_catch_up = 4) noexcept;
+  /// Starts, or resumes, the frame loop. The time since the
+  /// last frame, such as a pause, isn't counted.
+  /// @param now_ns The current time of the monotonic clock.
+  void start(std::uint64_t now_ns) noexcept;
+  /// Measures the time since the last frame.
+  /// @param now_ns The current time of the monotonic clock.
+  /// @returns The number of simulation steps to take.
+  std::size_t tick(std::uint64_t now_ns) noexcept;
+  /// Accesses the length of one simulation step.
+  inline std::size_t get_step_ms() const noexcept {
+    return clock.get_step_ms();
+  }
+  /// Accesses the clock that the steps are taken from.
+  inline const FixedStepClock& get_clock() const noexcept {
+    return clock;
+  }
+  /// Accesses the statistics on the frame times.
+  inline const FrameStats& get_stats() const noexcept {
+    return stats;
+  }
+};
+
+} // namespace herald
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace herald {
+
+/// Keeps running statistics on the
+/// time it takes to produce each frame.
+class FrameStats final {
+  /// The number of frames recorded.
+  std::size_t frame_count;
+  /// The number of frames that took noticeably
+  /// longer than the time budgeted for them.
+  std::size_t late_count;
+  /// The total time of all the recorded frames.
+  std::uint64_t total_ns;
+  /// The time of the shortest frame.
+  std::uint64_t min_ns;
+  /// The time of the longest frame.
+  std::uint64_t max_ns;
+  /// The time of the last frame.
+  std::uint64_t last_ns;
+public:
+  /// Constructs an empty set of statistics.
+  FrameStats() noexcept;
+  /// Records the time of one frame.
+  /// @param frame_ns The time between the start of this
+  /// frame and the start of the previous one, in nanoseconds.
+  /// @param budget_ns The time that the frame was meant to take.
+  /// Frames that take half again as long are counted as late.
+  void record(std::uint64_t frame_ns, std::uint64_t budget_ns) noexcept;
+  /// Discards all the recorded frames.
+  void reset() noexcept;
+  /// Accesses the number of recorded frames.
+  inline std::size_t get_frame_count() const noexcept {
+    return frame_count;
+  }
+  /// Accesses the number of frames that ran late.
+  inline std::size_t get_late_count() const noexcept {
+    return late_count;
+  }
+  /// Accesses the time of the shortest frame.
+  /// This is zero if no frames were recorded.
+  inline std::uint64_t get_min_ns() const noexcept {
+    return frame_count ? min_ns : 0;
+  }
+  /// Accesses the time of the longest frame.
+  inline std::uint64_t get_max_ns() const noexcept {
+    return max_ns;
+  }
+  /// Accesses the time of the last frame.
+  inline std::uint64_t get_last_ns() const noexcept {
+    return last_ns;
+  }
+  /// Calculates the average frame time.
+  /// This is zero if no frames were recorded.
+  inline std::uint64_t get_mean_ns() const noexcept {
+    return frame_count ? (total_ns / frame_count) : 0;
+  }
+};
+
+} // namespace herald
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Engine.h"
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+class FixedStepClock;
+
+/// An engine that only runs the simulation and never
+/// renders anything. It has no dependency on a window
+/// system, so it can be used on servers, for replays,
+/// for load tests and for benchmarks.
+///
+/// Time passed to @ref advance is turned into fixed-length
+/// steps, so the simulation is the same no matter how
+/// the real time happens to be sliced up.
+class HeadlessEngine : public Engine {
+public:
+  /// Creates a new headless engine.
+  /// @param step_ms The length of one simulation step, in milliseconds.
+  /// @param max_steps The most steps to take for one call to @ref advance.
+  /// Zero means the engine always catches up on all of the time it's given.
+  /// @returns A new headless engine instance.
+  static ScopedPtr<HeadlessEngine> make(std::size_t step_ms = 16, std::size_t max_steps = 0);
+  /// Just a stub.
+  virtual ~HeadlessEngine() {}
+  /// Takes a number of simulation steps,
+  /// regardless of how much real time has passed.
+  /// @param count The number of steps to take.
+  virtual void step(std::size_t count = 1) = 0;
+  /// Accesses the clock that drives the simulation.
+  virtual const FixedStepClock& get_clock() const noexcept = 0;
+  /// Indicates the number of steps taken so far.
+  virtual std::size_t get_step_count() const noexcept = 0;
+};
+
+} // namespace herald
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #ifndef SIZE_MAX
 #define SIZE_MAX 0xffff
@@ -7,16 +7,20 @@ namespace herald {
 template <typename T>
 class ScopedPtr;
 
-/// A model that's read from a JSON file.
+/// A model that's read from a JSON file. The file is
+/// streamed straight into the model's tables, without
+/// keeping the document in memory.
 class JsonModel : public Model {
 public:
   /// Opens up a model from a JSON file.
   /// @param filename The name of the file to open.
+  /// Relative texture paths are relative to the file's directory.
   /// @returns A pointer to the model on success, a null pointer on failure.
   static ScopedPtr<JsonModel> open(const char* filename);
   /// Reads a JSON model from a string.
   /// @param source The JSON source to read from.
-  /// @returns A new JSON model instance.
+  /// @returns A new JSON model instance, or a null
+  /// pointer if the source isn't valid JSON.
   static ScopedPtr<JsonModel> from_source(const char* source);
   /// Just a stub.
   virtual ~JsonModel() {}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace herald {
+
+/// Counts latencies into log-linear buckets, in the
+/// style of an HDR histogram. Values below @ref linear_limit
+/// are counted exactly. Above that, every power of two is split
+/// into @ref sub_bucket_count buckets of equal width, so a
+/// percentile is never off by more than about 3% of its value,
+/// and the whole range of 64-bit nanoseconds fits in about two
+/// thousand buckets.
+class LatencyHistogram final {
+  /// The number of values in each bucket.
+  std::vector<std::uint64_t> counts;
+  /// The number of recorded values.
+  std::uint64_t total_count;
+  /// The smallest recorded value.
+  std::uint64_t min_ns;
+  /// The largest recorded value.
+  std::uint64_t max_ns;
+public:
+  /// The number of buckets that each power of two is split into.
+  static const std::size_t sub_bucket_count;
+  /// Values below this are each counted in a bucket of their own.
+  static const std::uint64_t linear_limit;
+  /// Constructs an empty histogram.
+  LatencyHistogram();
+  /// Records one latency.
+  /// @param latency_ns The latency to record, in nanoseconds.
+  void record(std::uint64_t latency_ns) noexcept;
+  /// Discards all the recorded latencies.
+  void reset() noexcept;
+  /// Accesses the number of recorded latencies.
+  inline std::uint64_t get_count() const noexcept {
+    return total_count;
+  }
+  /// Accesses the smallest recorded latency.
+  /// This is zero if nothing was recorded.
+  inline std::uint64_t get_min_ns() const noexcept {
+    return total_count ? min_ns : 0;
+  }
+  /// Accesses the largest recorded latency.
+  inline std::uint64_t get_max_ns() const noexcept {
+    return max_ns;
+  }
+  /// Calculates the latency at a percentile.
+  /// @param percentile The percentile, from 0 to 100,
+  /// such as 99.9 for the p999 latency.
+  /// @returns The highest latency that's equivalent to the one
+  /// at the percentile, which is never more than the largest
+  /// recorded one. This is zero if nothing was recorded.
+  std::uint64_t get_percentile(double percentile) const noexcept;
+  /// Writes the summary of the histogram as a JSON object, with
+  /// the count, min, p50, p99, p999 and max in nanoseconds.
+  /// @param output The stream to write the object to.
+  void write_json(std::ostream& output) const;
+  /// Finds the bucket that a value is counted in.
+  /// @param value The value to find the bucket of.
+  static std::size_t to_bucket(std::uint64_t value) noexcept;
+  /// Finds the highest value that's counted in a bucket.
+  /// @param bucket The index of the bucket.
+  static std::uint64_t to_highest_value(std::size_t bucket) noexcept;
+};
+
+} // namespace herald
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <herald/LatencyHistogram.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace herald {
+
+/// Keeps a latency histogram for every command name,
+/// such as "build_room" or "update_axis". There are only
+/// a handful of command names, so they're kept in the order
+/// they were first seen and looked up one after the other.
+class LatencyTable final {
+  /// The histogram of one command name.
+  struct Entry final {
+    /// The name of the command.
+    std::string name;
+    /// The latencies of the command.
+    LatencyHistogram histogram;
+  };
+  /// The entry of every command name.
+  std::vector<Entry> entries;
+  /// The latency that was recorded last.
+  std::uint64_t last_ns = 0;
+public:
+  /// Records the latency of a command.
+  /// @param name The name of the command.
+  /// @param latency_ns The time between sending the command
+  /// and receiving its response, in nanoseconds.
+  void record(const char* name, std::uint64_t latency_ns);
+  /// Discards the latencies of every command.
+  void reset() noexcept;
+  /// Accesses the latency that was recorded last, of any command.
+  /// This is zero if nothing was recorded.
+  inline std::uint64_t get_last_ns() const noexcept {
+    return last_ns;
+  }
+  /// Indicates the number of command names that were recorded.
+  inline std::size_t get_name_count() const noexcept {
+    return entries.size();
+  }
+  /// Accesses a command name.
+  /// @param index The index of the name, which must be in bounds.
+  inline const char* get_name(std::size_t index) const noexcept {
+    return entries[index].name.c_str();
+  }
+  /// Accesses the histogram of a command name.
+  /// @param index The index of the name, which must be in bounds.
+  inline const LatencyHistogram& get_histogram(std::size_t index) const noexcept {
+    return entries[index].histogram;
+  }
+  /// Finds the histogram of a command.
+  /// @param name The name of the command.
+  /// @returns The histogram of the command, or null
+  /// if no latency was recorded for it.
+  const LatencyHistogram* find(const char* name) const noexcept;
+  /// Writes the summary of every histogram as a JSON
+  /// object, which maps each command name to its summary.
+  /// @param output The stream to write the object to.
+  void write_json(std::ostream& output) const;
+};
+
+} // namespace herald
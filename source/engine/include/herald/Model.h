@@ -8,6 +8,7 @@ class ScopedPtr;
 class ActionTable;
 class AnimationTable;
 class Background;
+class Camera;
 class Index;
 class ObjectTable;
 class Room;
@@ -24,12 +25,25 @@ public:
   virtual ActionTable* get_action_table() = 0;
   /// Accesses a pointer to the background instance.
   virtual Background* get_background() = 0;
+  /// Accesses a pointer to the camera that the room is seen through.
+  virtual Camera* get_camera() = 0;
   /// Accesses a pointer to the object map;
   virtual ObjectTable* get_object_table() = 0;
   /// Accesses a pointer to the model's room.
   virtual Room* get_room() = 0;
   /// Accesses a pointer to the texture table.
   virtual TextureTable* get_texture_table() = 0;
+  /// Hints the texture table to load every texture
+  /// that the animations of the room's tiles display.
+  /// This has to be called after the room is built,
+  /// since there's nothing to prefetch before then.
+  void prefetch_room_textures();
+  /// Hints the texture table to load every texture.
+  /// This is meant for games without a texture memory
+  /// budget, so that the textures are decoded in parallel
+  /// while the game opens, instead of one at a time as the
+  /// room is first painted.
+  void prefetch_all_textures();
 };
 
 } // namespace herald
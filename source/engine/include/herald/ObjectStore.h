@@ -0,0 +1,168 @@
+#pragma once
+
+#include <herald/Index.h>
+#include <herald/Vec2f.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace herald {
+
+class ActionTable;
+class AnimationTable;
+
+struct TileRange;
+
+/// Enumerates the parts of an object that may
+/// change between frames. These are used as bit flags,
+/// so that a frame only has to deal with the parts
+/// of the objects that actually changed.
+enum class ObjectChange : std::uint8_t {
+  /// The object was moved.
+  Position = 1 << 0,
+  /// The object was assigned a new action.
+  Action = 1 << 1,
+  /// The object has a new texture index.
+  Texture = 1 << 2,
+  /// The object has to be resized.
+  Size = 1 << 3
+};
+
+/// Keeps the state of all the objects in parallel
+/// arrays, one per attribute, instead of one heap
+/// instance per object. The per-frame passes are plain
+/// loops over these arrays, which the compiler is able
+/// to vectorize, and the objects that changed are reported
+/// as one contiguous range so that a view only has to look
+/// at that part of the store.
+///
+/// Indices are kept as 32-bit values. An index that is
+/// invalid, or doesn't fit, is stored as @ref invalid_index.
+class ObjectStore final {
+  /// The X coordinates of the objects.
+  std::vector<float> x_values;
+  /// The Y coordinates of the objects.
+  std::vector<float> y_values;
+  /// The action that each object is performing.
+  std::vector<std::uint32_t> action_indices;
+  /// The animation of each object's action.
+  std::vector<std::uint32_t> animation_indices;
+  /// The texture that each object is displaying.
+  std::vector<std::uint32_t> texture_indices;
+  /// The @ref ObjectChange flags of each object.
+  std::vector<std::uint8_t> changes;
+  /// Maps action indices to animation indices.
+  /// There's one extra entry at the end, which is
+  /// an invalid index, so that out of range actions
+  /// are looked up without a branch.
+  std::vector<std::uint32_t> action_animations;
+  /// Maps animation indices to the texture that each
+  /// animation displays at the current point in time.
+  /// Like @ref action_animations, there's an extra entry
+  /// at the end for out of range animations.
+  std::vector<std::uint32_t> animation_textures;
+  /// The first object that may have changed.
+  std::size_t changed_begin;
+  /// One past the last object that may have changed.
+  std::size_t changed_end;
+public:
+  /// The value used for indices that are invalid.
+  static const std::uint32_t invalid_index;
+  /// Constructs an empty object store.
+  ObjectStore() noexcept;
+  /// Resizes the object store. New objects are placed
+  /// at the origin, without an action, and are considered
+  /// to have changed entirely.
+  /// @param count The number of objects to keep.
+  void resize(std::size_t count);
+  /// Indicates the number of objects in the store.
+  inline std::size_t size() const noexcept {
+    return x_values.size();
+  }
+  /// Translates an object.
+  /// Out of bounds indices are ignored.
+  /// @param index The index of the object to translate.
+  /// @param delta_pos The change in position to apply.
+  void translate(Index index, const Vec2f& delta_pos) noexcept;
+  /// Sets the action for an object to perform.
+  /// Out of bounds indices are ignored.
+  /// @param index The index of the object to modify.
+  /// @param action_index The index of the action to perform.
+  void set_action_index(Index index, Index action_index) noexcept;
+  /// Marks part of every object as changed.
+  /// @param change The part of the objects that changed.
+  void mark_all_changed(ObjectChange change) noexcept;
+  /// Marks part of the objects that overlap exactly one of two
+  /// tile ranges as changed. When the view moves from one range
+  /// to the other, these are the objects that come into view or
+  /// leave it. Every position is still compared, but only these
+  /// objects are marked, so the view doesn't update the rest.
+  /// @param prev The range that was in view.
+  /// @param next The range that is now in view.
+  /// @param change The part of the objects that changed.
+  void mark_changed_between(const TileRange& prev,
+                            const TileRange& next,
+                            ObjectChange change) noexcept;
+  /// Looks up the animation index of every object from its action.
+  /// @param actions The action table to get the animation indices from.
+  void update_animation_indices(const ActionTable& actions);
+  /// Resolves the texture index of every object from its animation.
+  /// Each animation is only resolved once, regardless of how many
+  /// objects are performing it. Objects whose texture index changes
+  /// are marked with @ref ObjectChange::Texture.
+  /// @param ellapsed_ms The total number of ellapsed milliseconds.
+  /// @param animations The animation table to get the texture indices from.
+  void update_texture_indices(std::size_t ellapsed_ms, const AnimationTable& animations);
+  /// Accesses the position of an object.
+  /// @returns The position of the object, or the
+  /// origin if the index is out of bounds.
+  Vec2f get_position(Index index) const noexcept;
+  /// Accesses the action index of an object.
+  /// @returns The action index, which is invalid
+  /// if the object index is out of bounds.
+  Index get_action_index(Index index) const noexcept;
+  /// Accesses the animation index of an object.
+  /// @returns The animation index, which is invalid
+  /// if the object index is out of bounds.
+  Index get_animation_index(Index index) const noexcept;
+  /// Accesses the texture index of an object.
+  /// @returns The texture index, which is invalid
+  /// if the object index is out of bounds.
+  Index get_texture_index(Index index) const noexcept;
+  /// Indicates whether or not part of an object changed.
+  /// @param index The index of the object to check.
+  /// This must be less than @ref size.
+  /// @param change The part of the object to check.
+  inline bool has_change(std::size_t index, ObjectChange change) const noexcept {
+    return (changes[index] & ((std::uint8_t) change)) != 0;
+  }
+  /// Indicates whether or not any part of an object changed.
+  /// @param index The index of the object to check.
+  /// This must be less than @ref size.
+  inline bool has_changes(std::size_t index) const noexcept {
+    return changes[index] != 0;
+  }
+  /// Accesses the first object that may have changed.
+  /// Objects outside of the changed range have no changes.
+  inline std::size_t get_changed_begin() const noexcept {
+    return changed_begin;
+  }
+  /// Accesses one past the last object that may have changed.
+  /// This is equal to @ref get_changed_begin when nothing changed.
+  inline std::size_t get_changed_end() const noexcept {
+    return changed_end;
+  }
+  /// Clears the changes of all the objects,
+  /// once they've been applied.
+  void clear_changes() noexcept;
+private:
+  /// Marks a single object as changed.
+  void mark_changed(std::size_t index, ObjectChange change) noexcept;
+  /// Widens the changed range to include any objects that were
+  /// marked by one of the batch passes. Only the parts of the
+  /// store outside of the current range are scanned.
+  void extend_changed_range() noexcept;
+};
+
+} // namespace herald
@@ -6,20 +6,27 @@ namespace herald {
 
 class ActionTable;
 class Index;
-class Object;
+class Vec2f;
 
 /// Used to track items in the foreground,
 /// such as players, enemies, or moveable items.
+/// The objects are addressed by their index in the
+/// table, rather than as individual instances, so that
+/// implementations can keep them in an @ref ObjectStore.
 class ObjectTable {
 public:
   /// Just a stub.
   virtual ~ObjectTable() {}
-  /// Accesses an object at a specific index.
-  /// @param index The index of the object to access.
-  /// @returns A pointer to the specified object.
-  /// If the index is out of bounds, then a null
-  /// object instance is returned instead.
-  virtual Object* at(Index index) = 0;
+  /// Translates an object.
+  /// @param index The index of the object to translate.
+  /// If this is out of bounds, then nothing is done.
+  /// @param delta_pos The change in position to apply.
+  virtual void translate(Index index, const Vec2f& delta_pos) = 0;
+  /// Sets the action for an object to perform.
+  /// @param index The index of the object to modify.
+  /// If this is out of bounds, then nothing is done.
+  /// @param action_index The index of the action to perform.
+  virtual void set_action_index(Index index, Index action_index) = 0;
   /// Resizes the object table.
   /// @param count The new number of objects
   /// to have into the table.
@@ -29,7 +36,7 @@ public:
   virtual std::size_t size() const noexcept = 0;
   /// Updates the animation indices from the action table.
   /// @param actions The action table to get the animation indices from.
-  virtual void update_animation_indices(const ActionTable& actions);
+  virtual void update_animation_indices(const ActionTable& actions) = 0;
 };
 
 } // namespace herald
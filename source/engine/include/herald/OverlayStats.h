@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace herald {
+
+/// The numbers shown by the performance overlay of a
+/// @ref QtTarget. The frame times are recorded every frame,
+/// since that only writes to a ring. The rest are assigned
+/// by whoever owns the target, and only need to be kept up
+/// to date while the overlay is visible.
+class OverlayStats final {
+  /// The ring of recent frame times.
+  std::vector<std::uint64_t> frame_times;
+  /// Where the next frame time goes.
+  std::size_t next;
+  /// The number of frame times in the ring.
+  std::size_t count;
+  /// The sum of the frame times in the ring.
+  std::uint64_t total_ns;
+  /// The number of commands waiting for a response.
+  std::size_t queue_depth;
+  /// The round trip time of the last completed command.
+  std::uint64_t last_rtt_ns;
+  /// The number of bytes taken by decoded textures.
+  std::size_t texture_bytes;
+  /// The number of bytes that textures may take,
+  /// or zero if there is no limit.
+  std::size_t texture_budget;
+public:
+  /// The number of frame times that are kept.
+  static const std::size_t history_size;
+  /// Constructs an empty set of overlay statistics.
+  OverlayStats();
+  /// Records the time of one frame.
+  /// @param frame_ns The time between the start of this
+  /// frame and the start of the previous one, in nanoseconds.
+  void record_frame(std::uint64_t frame_ns) noexcept;
+  /// Indicates the number of frame times that are kept.
+  inline std::size_t get_frame_count() const noexcept {
+    return count;
+  }
+  /// Accesses a recent frame time.
+  /// @param index The index of the frame time, starting
+  /// at the oldest one. This must be in bounds.
+  std::uint64_t get_frame_ns(std::size_t index) const noexcept;
+  /// Finds the longest of the recent frame times.
+  std::uint64_t get_max_frame_ns() const noexcept;
+  /// Calculates the frame rate over the recent frames.
+  /// @returns The number of frames per second, or
+  /// zero if no frames were recorded.
+  double get_fps() const noexcept;
+  /// Assigns the number of commands waiting for a response.
+  inline void set_queue_depth(std::size_t depth) noexcept {
+    queue_depth = depth;
+  }
+  /// Accesses the number of commands waiting for a response.
+  inline std::size_t get_queue_depth() const noexcept {
+    return queue_depth;
+  }
+  /// Assigns the round trip time of the last completed command.
+  inline void set_last_rtt_ns(std::uint64_t rtt_ns) noexcept {
+    last_rtt_ns = rtt_ns;
+  }
+  /// Accesses the round trip time of the last completed command.
+  inline std::uint64_t get_last_rtt_ns() const noexcept {
+    return last_rtt_ns;
+  }
+  /// Assigns the texture memory in use and its budget.
+  /// @param bytes The number of bytes taken by decoded textures.
+  /// @param budget The number of bytes that textures may take,
+  /// or zero if there is no limit.
+  inline void set_texture_memory(std::size_t bytes, std::size_t budget) noexcept {
+    texture_bytes = bytes;
+    texture_budget = budget;
+  }
+  /// Accesses the number of bytes taken by decoded textures.
+  inline std::size_t get_texture_bytes() const noexcept {
+    return texture_bytes;
+  }
+  /// Accesses the texture memory budget, which is zero if there is no limit.
+  inline std::size_t get_texture_budget() const noexcept {
+    return texture_budget;
+  }
+};
+
+} // namespace herald
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace herald {
+
+/// A span of time spent in one stage of a frame.
+struct ProfileEvent final {
+  /// The name of the stage. This is expected
+  /// to be a string literal, so it isn't copied.
+  const char* name;
+  /// When the stage started, in nanoseconds.
+  std::uint64_t start_ns;
+  /// How long the stage took, in nanoseconds.
+  std::uint64_t duration_ns;
+};
+
+/// Collects the time spent in the stages of each frame.
+///
+/// Every thread records into its own ring buffer, which
+/// keeps the most recent @ref buffer_capacity events. When
+/// a thread exits, its events can still be exported until
+/// another thread starts recording, which then reuses its
+/// buffer. There are only as many buffers as there were
+/// threads recording at the same time.
+///
+/// Profiling is off by default. While it's off, a
+/// @ref ProfileScope costs a single branch on a flag.
+class Profiler final {
+  /// Whether or not events are being recorded.
+  static std::atomic<bool> enabled;
+public:
+  /// The number of events kept for each thread.
+  static const std::size_t buffer_capacity;
+  /// Indicates whether or not events are being recorded.
+  static inline bool is_enabled() noexcept {
+    return enabled.load(std::memory_order_relaxed);
+  }
+  /// Turns the recording of events on or off.
+  static void set_enabled(bool state) noexcept;
+  /// Indicates whether or not profiling is requested by
+  /// the environment, through the HERALD_PROFILE variable.
+  /// Any value other than an empty one or "0" requests it.
+  static bool enabled_by_environment() noexcept;
+  /// Accesses the current time of the profiling clock.
+  /// @returns The current time, in nanoseconds.
+  static std::uint64_t now_ns() noexcept;
+  /// Records an event into the calling thread's buffer.
+  /// @param name The name of the stage, which has to outlive the profiler.
+  /// @param start_ns When the stage started.
+  /// @param end_ns When the stage ended.
+  static void record(const char* name, std::uint64_t start_ns, std::uint64_t end_ns);
+  /// Discards the events of all threads.
+  static void clear();
+  /// Indicates the number of thread buffers that were allocated.
+  static std::size_t get_buffer_count();
+  /// Indicates the number of events kept, across all threads.
+  static std::size_t get_event_count();
+  /// Writes the events of all threads as a trace that can
+  /// be opened with chrome://tracing or the Perfetto UI.
+  /// @param output The stream to write the trace to.
+  static void write_chrome_trace(std::ostream& output);
+};
+
+/// Records the time spent in a scope, when profiling is enabled.
+class ProfileScope final {
+  /// The name of the stage, or null if
+  /// profiling was off when the scope started.
+  const char* name;
+  /// When the scope started.
+  std::uint64_t start_ns;
+public:
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator = (const ProfileScope&) = delete;
+  /// Starts timing a scope.
+  /// @param n The name of the stage, which has to be a string literal.
+  explicit ProfileScope(const char* n) noexcept : name(nullptr), start_ns(0) {
+    if (Profiler::is_enabled()) {
+      name = n;
+      start_ns = Profiler::now_ns();
+    }
+  }
+  /// Records the time spent in the scope.
+  ~ProfileScope() {
+    if (name) {
+      Profiler::record(name, start_ns, Profiler::now_ns());
+    }
+  }
+};
+
+} // namespace herald
@@ -9,9 +9,14 @@ template <typename T>
 class ScopedPtr;
 
 class Controller;
+class OverlayStats;
 class QtModel;
 
 /// A target for the Qt engine to render to.
+///
+/// Pressing F3 in the target window toggles a performance
+/// overlay, which is drawn over the scene without adding
+/// any items to it.
 class QtTarget {
 public:
   /// Creates a new Qt target instance.
@@ -30,6 +35,15 @@ public:
   /// Accesses a pointer to the window controller.
   /// @returns A pointer to the window controller.
   virtual Controller* get_controller() = 0;
+  /// Accesses the statistics shown by the performance overlay.
+  /// @returns A pointer to the overlay statistics.
+  virtual OverlayStats* get_overlay_stats() = 0;
+  /// Indicates whether or not the performance overlay is visible.
+  /// While it's hidden, its statistics don't need to be updated.
+  virtual bool is_overlay_visible() const = 0;
+  /// Repaints the performance overlay, if it's visible.
+  /// This should be called after its statistics change.
+  virtual void update_overlay() = 0;
   /// Shows the target window.
   virtual void show() = 0;
   /// Hides the target window.
@@ -1,11 +1,11 @@
 #pragma once
 
+#include "Tile.h"
+
 #include <cstddef>
 
 namespace herald {
 
-class Tile;
-
 /// A room is a grid of tiles used to create
 /// the appearance of a room. Tiles do not move
 /// but they may be animated.
@@ -27,6 +27,24 @@ public:
   /// then a pointer to a null tile instance is
   /// returned instead.
   virtual Tile* at(std::size_t x, std::size_t y) = 0;
+  /// Assigns the animation indices of the tiles, row by row.
+  /// A negative index leaves the tile without an animation.
+  /// @param indices The animation indices to assign.
+  /// @param count The number of indices. If this is less
+  /// than the number of tiles, then the remaining tiles
+  /// are left as they are.
+  virtual void assign_animation_indices(const int* indices, std::size_t count) {
+
+    if (!w) {
+      return;
+    }
+
+    auto tile_count = w * h;
+
+    for (std::size_t i = 0; (i < count) && (i < tile_count); i++) {
+      at(i % w, i / w)->set_animation_index((std::size_t) indices[i]);
+    }
+  }
   /// Resizes the room.
   /// @param width The width to assign the room.
   /// @param height The height to assign the room.
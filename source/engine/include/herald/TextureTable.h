@@ -1,18 +1,85 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace herald {
 
+class Index;
+
+/// Describes how a texture table is using memory.
+struct TextureCacheStats final {
+  /// The number of bytes taken by the decoded textures.
+  std::size_t resident_bytes = 0;
+  /// The number of bytes that the decoded textures
+  /// may take, or zero if there is no limit.
+  std::size_t memory_budget = 0;
+  /// The number of times a texture was used while decoded.
+  std::size_t hit_count = 0;
+  /// The number of times a texture had to be decoded to be used.
+  std::size_t miss_count = 0;
+  /// The number of textures that were released to fit the budget.
+  std::size_t eviction_count = 0;
+};
+
 /// The base class for a texture table.
 /// Used by @ref CpuModelImpl
 class TextureTable {
 public:
+  /// Used to observe the progress of
+  /// textures that are loaded in the background.
+  class Observer {
+  public:
+    /// Just a stub.
+    virtual ~Observer() {}
+    /// Called each time a texture is done loading.
+    /// @param loaded_count The number of textures that are done loading.
+    /// @param total_count The number of textures being waited for.
+    virtual void texture_loaded(std::size_t loaded_count, std::size_t total_count) = 0;
+  };
   /// Just a stub.
   virtual ~TextureTable() {}
-  /// Opens a new texture.
+  /// Opens a new texture. The texture may not be loaded
+  /// until it's used, but its index is always the size
+  /// of the table before the call.
   /// @param filename The path to the texture to open.
   virtual void open(const char* filename) = 0;
+  /// Adds a texture from pixels that are already decoded.
+  /// The pixels aren't copied, so they have to stay valid
+  /// for as long as the texture table exists.
+  /// @param pixels The premultiplied ARGB pixels of the
+  /// texture, one row after the other, without padding.
+  /// @param width The width of the texture, in pixels.
+  /// @param height The height of the texture, in pixels.
+  virtual void open_pixels(const std::uint32_t* pixels, std::size_t width, std::size_t height) = 0;
+  /// Hints that a texture is about to be used, so that
+  /// it may be loaded in the background ahead of time.
+  /// By default, this does nothing.
+  /// @param index The index of the texture.
+  virtual void prefetch(Index index) {
+    (void) index;
+  }
+  /// Waits for the textures being loaded in the background.
+  /// By default, textures are loaded as soon as they're opened,
+  /// so there is nothing to wait for.
+  /// @param observer An optional observer of the progress.
+  virtual void finish_loading(Observer* observer = nullptr) {
+    (void) observer;
+  }
+  /// Limits the memory taken by the loaded textures. The least
+  /// recently used textures are released to stay within the limit,
+  /// and are loaded again the next time they're used.
+  /// By default, this does nothing.
+  /// @param bytes The number of bytes the textures may take,
+  /// or zero to keep every texture that's loaded.
+  virtual void set_memory_budget(std::size_t bytes) {
+    (void) bytes;
+  }
+  /// Accesses the memory usage of the texture table.
+  /// By default, this is all zeros.
+  virtual TextureCacheStats get_cache_stats() const {
+    return TextureCacheStats();
+  }
   /// Indicates the size of the texture table.
   /// @returns The size of the texture table.
   virtual std::size_t size() const noexcept = 0;
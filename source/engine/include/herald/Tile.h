@@ -23,7 +23,6 @@ public:
   inline void set_animation_index(Index index) {
     animation_index = index;
   }
-protected:
   /// Accesses the index of the animation
   /// for this tile.
   inline Index get_animation_index() const noexcept {
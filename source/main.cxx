@@ -1,4 +1,7 @@
 #include <QApplication>
+#include <QSettings>
+
+#include <herald/Profiler.h>
 
 #include "Manager.h"
 #include "MainWindow.h"
@@ -11,6 +14,12 @@ int main(int argc, char** argv) {
 
   Q_INIT_RESOURCE(icons);
 
+  {
+    QSettings settings;
+    herald::Profiler::set_enabled(settings.value("Profiling").toBool()
+                               || herald::Profiler::enabled_by_environment());
+  }
+
   auto* manager = Manager::make(&app);
 
   MainWindow main_window;
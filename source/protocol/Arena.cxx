@@ -0,0 +1,124 @@
+#include <herald/protocol/Arena.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace herald {
+
+namespace protocol {
+
+struct Arena::Block final {
+  /// The next block in the arena.
+  Block* next;
+  /// The number of bytes that follow the block header.
+  std::size_t size;
+  /// The number of bytes that were allocated.
+  std::size_t used;
+  /// Accesses the memory that follows the block header.
+  unsigned char* data() noexcept {
+    return reinterpret_cast<unsigned char*>(this + 1);
+  }
+  /// Allocates memory from the block.
+  /// @returns A pointer to the memory, or null if it doesn't fit.
+  void* allocate(std::size_t n, std::size_t alignment) noexcept {
+
+    auto address = reinterpret_cast<std::uintptr_t>(data() + used);
+
+    auto padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+
+    if ((used + padding + n) > size) {
+      return nullptr;
+    }
+
+    auto* ptr = data() + used + padding;
+
+    used += padding + n;
+
+    return ptr;
+  }
+};
+
+Arena::Arena(std::size_t initial_block_size) noexcept
+  : first(nullptr),
+    current(nullptr),
+    next_block_size(initial_block_size) {}
+
+Arena::~Arena() {
+  while (first) {
+    auto* next = first->next;
+    std::free(first);
+    first = next;
+  }
+}
+
+void* Arena::allocate(std::size_t size, std::size_t alignment) {
+
+  if (current) {
+
+    auto* ptr = current->allocate(size, alignment);
+    if (ptr) {
+      return ptr;
+    }
+
+    // Blocks after the current one are
+    // left over from before the last reset.
+    while (current->next) {
+      current = current->next;
+      ptr = current->allocate(size, alignment);
+      if (ptr) {
+        return ptr;
+      }
+    }
+  }
+
+  auto block_size = next_block_size;
+
+  while (block_size < (size + alignment)) {
+    block_size *= 2;
+  }
+
+  auto* block = static_cast<Block*>(std::malloc(sizeof(Block) + block_size));
+  if (!block) {
+    throw std::bad_alloc();
+  }
+
+  block->next = nullptr;
+  block->size = block_size;
+  block->used = 0;
+
+  if (current) {
+    current->next = block;
+  } else {
+    first = block;
+  }
+
+  current = block;
+
+  next_block_size = block_size * 2;
+
+  return block->allocate(size, alignment);
+}
+
+void Arena::reset() noexcept {
+
+  for (auto* block = first; block; block = block->next) {
+    block->used = 0;
+  }
+
+  current = first;
+}
+
+std::size_t Arena::get_capacity() const noexcept {
+
+  std::size_t capacity = 0;
+
+  for (auto* block = first; block; block = block->next) {
+    capacity += block->size;
+  }
+
+  return capacity;
+}
+
+} // namespace protocol
+
+} // namespace herald
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <herald/protocol/Arena.h>
+
+#include <cstddef>
+#include <new>
+
+namespace herald {
+
+namespace protocol {
+
+/// An array that grows within an arena.
+/// When it runs out of space, the elements are copied
+/// into a new array twice the size and the old array
+/// is left to the arena. The destructors of the
+/// elements are never called.
+template <typename T>
+class ArenaArray final {
+  /// The arena to allocate from.
+  Arena* arena;
+  /// The elements of the array.
+  T* data;
+  /// The number of elements in the array.
+  std::size_t count;
+  /// The number of elements there is room for.
+  std::size_t capacity;
+public:
+  /// Constructs an empty array.
+  /// @param a The arena to allocate from.
+  constexpr ArenaArray(Arena* a) noexcept
+    : arena(a), data(nullptr), count(0), capacity(0) {}
+  /// Accesses an element of the array.
+  inline const T& operator [] (std::size_t index) const noexcept {
+    return data[index];
+  }
+  /// Accesses the first element of the array.
+  inline const T* get_data() const noexcept {
+    return data;
+  }
+  /// Indicates the number of elements in the array.
+  inline std::size_t size() const noexcept {
+    return count;
+  }
+  /// Makes room for a number of elements.
+  void reserve(std::size_t n) {
+
+    if (n <= capacity) {
+      return;
+    }
+
+    auto* new_data = arena->make_array<T>(n);
+
+    for (std::size_t i = 0; i < count; i++) {
+      new (&new_data[i]) T(data[i]);
+    }
+
+    data = new_data;
+    capacity = n;
+  }
+  /// Adds an element to the end of the array.
+  void push_back(const T& value) {
+
+    if (count >= capacity) {
+      reserve((capacity > 0) ? (capacity * 2) : 16);
+    }
+
+    new (&data[count++]) T(value);
+  }
+};
+
+} // namespace protocol
+
+} // namespace herald
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Arena.h>
+#include <herald/protocol/Lexer.h>
+#include <herald/protocol/ParseTree.h>
+#include <herald/protocol/Parser.h>
+#include <herald/protocol/SyntaxChecker.h>
+#include <herald/protocol/Token.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace herald;
+using namespace herald::protocol;
+
+namespace {
+
+/// The number of heap allocations made by the test program.
+std::size_t allocation_count = 0;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count++;
+  auto* ptr = std::malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+/// Interprets the responses in a piece of stream data
+/// the way the game process API does, with everything
+/// allocated from the arena.
+/// @returns The number of syntax errors found.
+std::size_t interpret(StreamLexer& lexer, const char* data, Arena& arena) {
+
+  lexer.write(data, std::strlen(data));
+
+  std::size_t error_count = 0;
+
+  while (lexer.next_line()) {
+
+    auto* parser = Parser::make(lexer.get_tokens(), lexer.get_token_count(), arena);
+
+    auto* errors = SyntaxErrorList::make(arena);
+
+    auto* checker = make_syntax_checker(errors, arena);
+
+    auto* node = parser->parse_any();
+    if (node) {
+      node->accept(*checker);
+    } else {
+      parser->parse_matrix()->accept(*checker);
+    }
+
+    error_count += errors->size();
+
+    arena.reset();
+  }
+
+  return error_count;
+}
+
+/// Interprets a fixed set of responses.
+/// @returns The number of syntax errors found.
+std::size_t interpret_all(StreamLexer& lexer, Arena& arena) {
+
+  const char* responses[] = {
+    "set_action 4 5\n",
+    "3 2 1 2 3 4 5 6\n",
+    "2 2 1 x 3\n"
+  };
+
+  std::size_t error_count = 0;
+
+  for (const auto* response : responses) {
+    error_count += interpret(lexer, response, arena);
+  }
+
+  return error_count;
+}
+
+} // namespace
+
+TEST(Arena, Allocate) {
+
+  Arena arena(64);
+
+  auto* a = arena.allocate(3, 1);
+  auto* b = arena.allocate(8, 8);
+  auto* c = arena.allocate(128, 16);
+
+  EXPECT_NE(a, nullptr);
+  EXPECT_EQ(((std::uintptr_t) b) % 8, 0);
+  EXPECT_EQ(((std::uintptr_t) c) % 16, 0);
+
+  EXPECT_GE(arena.get_capacity(), 64 + 128);
+}
+
+TEST(Arena, Reset) {
+
+  Arena arena(64);
+
+  for (int i = 0; i < 16; i++) {
+    arena.make<std::uint64_t>(i);
+  }
+
+  auto capacity = arena.get_capacity();
+
+  arena.reset();
+
+  for (int i = 0; i < 16; i++) {
+    arena.make<std::uint64_t>(i);
+  }
+
+  EXPECT_EQ(arena.get_capacity(), capacity);
+}
+
+TEST(Arena, SteadyStateAllocations) {
+
+  auto lexer = StreamLexer::make();
+
+  Arena arena;
+
+  // Warm up, so that the lexer and the
+  // arena have grown to their working size.
+  EXPECT_EQ(interpret_all(*lexer, arena), 2);
+
+  auto before = allocation_count;
+
+  auto error_count = interpret_all(*lexer, arena);
+
+  auto after = allocation_count;
+
+  EXPECT_EQ(error_count, 2);
+  EXPECT_EQ(after - before, 0);
+}
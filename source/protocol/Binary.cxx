@@ -0,0 +1,243 @@
+#include <herald/protocol/Binary.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <cstring>
+#include <vector>
+
+namespace herald {
+
+namespace protocol {
+
+namespace {
+
+/// Decodes a little-endian 32-bit value.
+/// @param data The four bytes to decode.
+inline std::uint32_t decode_u32(const unsigned char* data) noexcept {
+  return ((std::uint32_t) data[0])
+      | (((std::uint32_t) data[1]) << 8)
+      | (((std::uint32_t) data[2]) << 16)
+      | (((std::uint32_t) data[3]) << 24);
+}
+
+/// An implementation of the frame decoder interface.
+class FrameDecoderImpl final : public FrameDecoder {
+  /// The stream data that has not yet been discarded.
+  std::vector<unsigned char> buffer;
+  /// The number of bytes written to the buffer.
+  std::size_t used;
+  /// The start of the next frame.
+  std::size_t head;
+  /// The start of the current payload.
+  std::size_t payload_offset;
+  /// The size of the current payload.
+  std::size_t payload_size;
+  /// The sequence ID of the current frame.
+  std::uint32_t sequence_id;
+  /// The description of the framing error,
+  /// or null if there hasn't been one.
+  const char* error_description;
+public:
+  /// Constructs a new frame decoder.
+  FrameDecoderImpl()
+    : used(0),
+      head(0),
+      payload_offset(0),
+      payload_size(0),
+      sequence_id(untagged_sequence_id),
+      error_description(nullptr) {}
+  /// Reserves space at the end of the buffer.
+  char* reserve(std::size_t size) override {
+
+    if (buffer.size() < (used + size)) {
+      auto next_size = buffer.size() * 2;
+      buffer.resize((next_size < (used + size)) ? (used + size) : next_size);
+    }
+
+    return (char*) (buffer.data() + used);
+  }
+  /// Adds the reserved data to the stream.
+  void commit(std::size_t size) override {
+    // After a framing error, the data can't
+    // be split into frames, so it's dropped.
+    if (!error_description) {
+      used += size;
+    }
+  }
+  /// Copies data into the stream.
+  void write(const char* data, std::size_t size) override {
+    std::memcpy(reserve(size), data, size);
+    commit(size);
+  }
+  /// Goes to the next complete frame.
+  bool next_frame() override;
+  /// Accesses the sequence ID of the frame.
+  std::uint32_t get_sequence_id() const noexcept override {
+    return sequence_id;
+  }
+  /// Accesses the payload of the frame.
+  const unsigned char* get_payload() const noexcept override {
+    return buffer.data() + payload_offset;
+  }
+  /// Accesses the size of the payload.
+  std::size_t get_payload_size() const noexcept override {
+    return payload_size;
+  }
+  /// Indicates whether there was a framing error.
+  bool has_error() const noexcept override {
+    return error_description != nullptr;
+  }
+  /// Describes the framing error.
+  const char* get_error_description() const noexcept override {
+    return error_description;
+  }
+protected:
+  /// Moves the unfinished frame to the front of the buffer.
+  void compact() noexcept {
+    if (head > 0) {
+      std::memmove(buffer.data(), buffer.data() + head, used - head);
+      used -= head;
+      head = 0;
+    }
+  }
+  /// Enters the error state and discards the stream.
+  /// @param description A description of the error.
+  void fail(const char* description) noexcept {
+    error_description = description;
+    used = 0;
+    head = 0;
+  }
+};
+
+bool FrameDecoderImpl::next_frame() {
+
+  payload_offset = 0;
+  payload_size = 0;
+  sequence_id = untagged_sequence_id;
+
+  if (error_description) {
+    return false;
+  }
+
+  auto available = used - head;
+
+  if (available < frame_header_size) {
+    compact();
+    return false;
+  }
+
+  auto length = (std::size_t) decode_u32(buffer.data() + head);
+
+  if (length < 4) {
+    fail("Binary frame is too short to hold its sequence ID.");
+    return false;
+  } else if (length > max_frame_size) {
+    fail("Binary frame is larger than the frame size limit.");
+    return false;
+  }
+
+  if ((available - 4) < length) {
+    compact();
+    return false;
+  }
+
+  sequence_id = decode_u32(buffer.data() + head + 4);
+
+  payload_offset = head + frame_header_size;
+  payload_size = length - 4;
+
+  head += length + 4;
+
+  return true;
+}
+
+} // namespace
+
+Opcode find_opcode(const char* name) noexcept {
+
+  struct Entry final {
+    const char* name;
+    Opcode opcode;
+  };
+
+  static const Entry entries[] = {
+    { "build_object_map", Opcode::BuildObjectMap },
+    { "build_room", Opcode::BuildRoom },
+    { "exit", Opcode::Exit },
+    { "set_background", Opcode::SetBackground },
+    { "update_axis", Opcode::UpdateAxis },
+    { "update_batch", Opcode::UpdateBatch },
+    { "update_button", Opcode::UpdateButton }
+  };
+
+  for (const auto& entry : entries) {
+    if (std::strcmp(entry.name, name) == 0) {
+      return entry.opcode;
+    }
+  }
+
+  return Opcode::None;
+}
+
+bool BinaryReader::read_u32(std::uint32_t& value) noexcept {
+
+  if (remaining() < 4) {
+    return false;
+  }
+
+  value = decode_u32(data + pos);
+
+  pos += 4;
+
+  return true;
+}
+
+bool BinaryReader::read_i32(std::int32_t& value) noexcept {
+
+  std::uint32_t bits = 0;
+
+  if (!read_u32(bits)) {
+    return false;
+  }
+
+  std::memcpy(&value, &bits, sizeof(value));
+
+  return true;
+}
+
+bool BinaryReader::read_f32(float& value) noexcept {
+
+  std::uint32_t bits = 0;
+
+  if (!read_u32(bits)) {
+    return false;
+  }
+
+  std::memcpy(&value, &bits, sizeof(value));
+
+  return true;
+}
+
+bool BinaryReader::read_i32_array(std::int32_t* values, std::size_t count) noexcept {
+
+  if ((remaining() / 4) < count) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < count; i++) {
+    std::uint32_t bits = decode_u32(data + pos + (i * 4));
+    std::memcpy(&values[i], &bits, sizeof(bits));
+  }
+
+  pos += count * 4;
+
+  return true;
+}
+
+ScopedPtr<FrameDecoder> FrameDecoder::make() {
+  return new FrameDecoderImpl();
+}
+
+} // namespace protocol
+
+} // namespace herald
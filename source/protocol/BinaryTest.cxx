@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Binary.h>
+#include <herald/protocol/Command.h>
+
+#include <cstdint>
+
+using namespace herald;
+using namespace herald::protocol;
+
+TEST(FrameDecoder, SplitFrames) {
+
+  const unsigned char stream[] = {
+    // Frame with sequence ID 3 and an int32 payload.
+    8, 0, 0, 0,
+    3, 0, 0, 0,
+    0xfe, 0xff, 0xff, 0xff,
+    // Untagged frame with an empty payload.
+    4, 0, 0, 0,
+    0xff, 0xff, 0xff, 0xff
+  };
+
+  auto decoder = FrameDecoder::make();
+
+  decoder->write((const char*) stream, 10);
+
+  EXPECT_EQ(decoder->next_frame(), false);
+
+  decoder->write((const char*) stream + 10, sizeof(stream) - 10);
+
+  ASSERT_EQ(decoder->next_frame(), true);
+  EXPECT_EQ(decoder->get_sequence_id(), 3);
+  ASSERT_EQ(decoder->get_payload_size(), 4);
+
+  BinaryReader reader(decoder->get_payload(), decoder->get_payload_size());
+
+  std::int32_t value = 0;
+  EXPECT_EQ(reader.read_i32(value), true);
+  EXPECT_EQ(value, -2);
+  EXPECT_EQ(reader.done(), true);
+  EXPECT_EQ(reader.read_i32(value), false);
+
+  ASSERT_EQ(decoder->next_frame(), true);
+  EXPECT_EQ(decoder->get_sequence_id(), untagged_sequence_id);
+  EXPECT_EQ(decoder->get_payload_size(), 0);
+
+  EXPECT_EQ(decoder->next_frame(), false);
+}
+
+TEST(Command, BinaryEncoding) {
+
+  auto command = Command::make_button_update(1, 2, true, Encoding::Binary);
+
+  command->set_sequence_id(5);
+
+  const unsigned char expected[] = {
+    20, 0, 0, 0,
+    5, 0, 0, 0,
+    (unsigned char) Opcode::UpdateButton, 0, 0, 0,
+    1, 0, 0, 0,
+    2, 0, 0, 0,
+    1, 0, 0, 0
+  };
+
+  ASSERT_EQ(command->get_size(), sizeof(expected));
+
+  for (std::size_t i = 0; i < sizeof(expected); i++) {
+    EXPECT_EQ((unsigned char) command->get_data()[i], expected[i]) << "at byte " << i;
+  }
+}
+
+TEST(FrameDecoder, ShortFrame) {
+
+  const unsigned char stream[] = {
+    // Frame that is too short to hold its sequence ID.
+    2, 0, 0, 0,
+    0, 0, 0, 0,
+    // Untagged frame with an empty payload.
+    4, 0, 0, 0,
+    0xff, 0xff, 0xff, 0xff
+  };
+
+  auto decoder = FrameDecoder::make();
+
+  decoder->write((const char*) stream, sizeof(stream));
+
+  EXPECT_EQ(decoder->has_error(), false);
+  EXPECT_EQ(decoder->get_error_description(), nullptr);
+
+  EXPECT_EQ(decoder->next_frame(), false);
+  EXPECT_EQ(decoder->has_error(), true);
+  EXPECT_NE(decoder->get_error_description(), nullptr);
+
+  // The stream can't be resynchronized after
+  // the error, so the frame after it is lost.
+  EXPECT_EQ(decoder->next_frame(), false);
+
+  decoder->write((const char*) stream + 8, 8);
+
+  EXPECT_EQ(decoder->next_frame(), false);
+  EXPECT_EQ(decoder->has_error(), true);
+}
+
+TEST(FrameDecoder, OversizedFrame) {
+
+  const auto length = (std::uint32_t) (max_frame_size + 1);
+
+  const unsigned char stream[] = {
+    (unsigned char) (length & 0xff),
+    (unsigned char) ((length >> 8) & 0xff),
+    (unsigned char) ((length >> 16) & 0xff),
+    (unsigned char) ((length >> 24) & 0xff),
+    3, 0, 0, 0
+  };
+
+  auto decoder = FrameDecoder::make();
+
+  decoder->write((const char*) stream, sizeof(stream));
+
+  // The error is found from the header alone,
+  // without waiting for the rest of the frame.
+  EXPECT_EQ(decoder->next_frame(), false);
+  EXPECT_EQ(decoder->has_error(), true);
+  EXPECT_NE(decoder->get_error_description(), nullptr);
+}
@@ -2,6 +2,11 @@
 
 #include <herald/ScopedPtr.h>
 
+#include <herald/protocol/Binary.h>
+#include <herald/protocol/InputBatch.h>
+
+#include <cstdint>
+#include <cstring>
 #include <string>
 
 namespace herald {
@@ -12,10 +17,48 @@ namespace {
 
 /// The base of most commands.
 /// Contains a string to add data to.
+/// Operands are appended in either the text
+/// encoding, with one operand per line, or the
+/// binary encoding, with fixed-width little-endian
+/// values inside of a length-prefixed frame.
 class CommandBase : public Command {
+  /// The name of the command.
+  std::string name;
   /// The command data.
   std::string data;
+  /// The encoding of the command data.
+  Encoding encoding;
+  /// The number of bytes at the start of
+  /// the data taken up by the sequence ID line.
+  /// This is only used by the text encoding.
+  std::size_t header_size;
+  /// The sequence ID of the command.
+  std::size_t sequence_id;
+  /// Whether or not a sequence ID was assigned.
+  bool sequenced;
 public:
+  /// Constructs the base of the command.
+  /// @param name The name of the command.
+  /// @param e The encoding of the command data.
+  CommandBase(const char* n, Encoding e)
+    : name(n),
+      encoding(e),
+      header_size(0),
+      sequence_id(0),
+      sequenced(false) {
+    if (encoding == Encoding::Binary) {
+      append_u32(0);
+      append_u32(untagged_sequence_id);
+      append_u32((std::uint32_t) find_opcode(n));
+    } else {
+      data += n;
+      data += '\n';
+    }
+  }
+  /// Accesses the name of the command.
+  const char* get_name() const noexcept override {
+    return name.c_str();
+  }
   /// Accesses the command data.
   const char* get_data() const noexcept override {
     return data.c_str();
@@ -24,31 +67,91 @@ public:
   std::size_t get_size() const noexcept override {
     return data.size();
   }
-protected:
-  /// Appends a string to the command data.
-  /// @param str The string to append.
-  void append(const char* str) {
-    data += str;
+  /// Indicates if a sequence ID was assigned.
+  bool has_sequence_id() const noexcept override {
+    return sequenced;
+  }
+  /// Accesses the sequence ID.
+  std::size_t get_sequence_id() const noexcept override {
+    return sequence_id;
   }
-  /// Appends a single character to the command data.
-  /// @param c The character to append.
-  void append(char c) {
-    data += c;
+  /// Assigns the sequence ID, replacing
+  /// the previous one if there was one.
+  void set_sequence_id(std::size_t id) override {
+    if (encoding == Encoding::Binary) {
+      write_u32(4, (std::uint32_t) id);
+    } else {
+      auto header = "seq " + std::to_string(id) + "\n";
+      data.replace(0, header_size, header);
+      header_size = header.size();
+    }
+    sequence_id = id;
+    sequenced = true;
+  }
+protected:
+  /// Completes the command data. This must be called
+  /// by derived classes after all operands are added,
+  /// so that the length prefix of a binary frame is set.
+  void finish() {
+    if (encoding == Encoding::Binary) {
+      write_u32(0, (std::uint32_t) (data.size() - 4));
+    }
   }
   /// Appends a boolean value to the command data.
   /// @param value The value to append.
   void append(bool value) {
-    data += value ? "1" : "0";
+    if (encoding == Encoding::Binary) {
+      append_u32(value ? 1 : 0);
+    } else {
+      data += value ? "1\n" : "0\n";
+    }
   }
   /// Appends a size value to the command data.
   /// @param value The value to append.
   void append(std::size_t value) {
-    data += std::to_string(value);
+    if (encoding == Encoding::Binary) {
+      append_u32((std::uint32_t) value);
+    } else {
+      data += std::to_string(value);
+      data += '\n';
+    }
   }
   /// Appends a floating point value to the command data.
+  /// The binary encoding uses a 32-bit float.
   /// @param value The value to append.
   void append(double value) {
-    data += std::to_string(value);
+    if (encoding == Encoding::Binary) {
+      auto f = (float) value;
+      std::uint32_t bits = 0;
+      std::memcpy(&bits, &f, sizeof(bits));
+      append_u32(bits);
+    } else {
+      data += std::to_string(value);
+      data += '\n';
+    }
+  }
+private:
+  /// Appends a little-endian 32-bit value.
+  /// @param value The value to append.
+  void append_u32(std::uint32_t value) {
+    char bytes[4];
+    encode_u32(bytes, value);
+    data.append(bytes, 4);
+  }
+  /// Overwrites a little-endian 32-bit value.
+  /// @param offset The offset of the value within the data.
+  /// @param value The value to write.
+  void write_u32(std::size_t offset, std::uint32_t value) {
+    char bytes[4];
+    encode_u32(bytes, value);
+    data.replace(offset, 4, bytes, 4);
+  }
+  /// Encodes a little-endian 32-bit value.
+  static void encode_u32(char* bytes, std::uint32_t value) noexcept {
+    bytes[0] = (char) (value & 0xff);
+    bytes[1] = (char) ((value >> 8) & 0xff);
+    bytes[2] = (char) ((value >> 16) & 0xff);
+    bytes[3] = (char) ((value >> 24) & 0xff);
   }
 };
 
@@ -57,39 +160,64 @@ class NullaryCommand final : public CommandBase {
 public:
   /// Creates a command with no operands.
   /// @param name The name of the command.
-  NullaryCommand(const char* name) {
-    append(name);
-    append('\n');
+  /// @param e The encoding of the command data.
+  NullaryCommand(const char* name, Encoding e) : CommandBase(name, e) {
+    finish();
   }
 };
 
 /// A command for updating a controller axis.
 class AxisUpdateCommand final : public CommandBase {
 public:
-  AxisUpdateCommand(std::size_t c, double x, double y) {
-    append("update_axis");
-    append('\n');
+  AxisUpdateCommand(std::size_t c, double x, double y, Encoding e)
+    : CommandBase("update_axis", e) {
     append(c);
-    append('\n');
     append(x);
-    append('\n');
     append(y);
-    append('\n');
+    finish();
   }
 };
 
 /// A command for updating a controller button state.
 class ButtonUpdateCommand final : public CommandBase {
 public:
-  ButtonUpdateCommand(std::size_t c, std::size_t b, bool state) {
-    append("update_button");
-    append('\n');
+  ButtonUpdateCommand(std::size_t c, std::size_t b, bool state, Encoding e)
+    : CommandBase("update_button", e) {
     append(c);
-    append('\n');
     append(b);
-    append('\n');
     append(state);
-    append('\n');
+    finish();
+  }
+};
+
+/// A command for updating several
+/// controller inputs at once.
+class BatchUpdateCommand final : public CommandBase {
+public:
+  BatchUpdateCommand(const InputBatch& batch, Encoding e)
+    : CommandBase("update_batch", e) {
+
+    const auto* axes = batch.get_axes();
+
+    append(batch.get_axis_count());
+
+    for (std::size_t i = 0; i < batch.get_axis_count(); i++) {
+      append(axes[i].controller);
+      append(axes[i].x);
+      append(axes[i].y);
+    }
+
+    const auto* edges = batch.get_button_edges();
+
+    append(batch.get_button_edge_count());
+
+    for (std::size_t i = 0; i < batch.get_button_edge_count(); i++) {
+      append(edges[i].controller);
+      append(edges[i].button);
+      append(edges[i].state);
+    }
+
+    finish();
   }
 };
 
@@ -97,12 +225,22 @@ public:
 /// as a placeholder.
 class NullCommand final : public Command {
 public:
+  const char* get_name() const noexcept override {
+    return "";
+  }
   const char* get_data() const noexcept override {
     return "";
   }
   std::size_t get_size() const noexcept override {
     return 0;
   }
+  bool has_sequence_id() const noexcept override {
+    return false;
+  }
+  std::size_t get_sequence_id() const noexcept override {
+    return 0;
+  }
+  void set_sequence_id(std::size_t) override {}
 };
 
 } // namespace
@@ -111,16 +249,20 @@ ScopedPtr<Command> Command::make_null() {
   return new NullCommand();
 }
 
-ScopedPtr<Command> Command::make_nullary(const char* name) {
-  return new NullaryCommand(name);
+ScopedPtr<Command> Command::make_nullary(const char* name, Encoding encoding) {
+  return new NullaryCommand(name, encoding);
+}
+
+ScopedPtr<Command> Command::make_axis_update(std::size_t controller, double x, double y, Encoding encoding) {
+  return new AxisUpdateCommand(controller, x, y, encoding);
 }
 
-ScopedPtr<Command> Command::make_axis_update(std::size_t controller, double x, double y) {
-  return new AxisUpdateCommand(controller, x, y);
+ScopedPtr<Command> Command::make_button_update(std::size_t controller, std::size_t button, bool state, Encoding encoding) {
+  return new ButtonUpdateCommand(controller, button, state, encoding);
 }
 
-ScopedPtr<Command> Command::make_button_update(std::size_t controller, std::size_t button, bool state) {
-  return new ButtonUpdateCommand(controller, button, state);
+ScopedPtr<Command> Command::make_batch_update(const InputBatch& batch, Encoding encoding) {
+  return new BatchUpdateCommand(batch, encoding);
 }
 
 } // namespace protocol
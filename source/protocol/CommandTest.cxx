@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Command.h>
+
+#include <string>
+
+using namespace herald;
+using namespace herald::protocol;
+
+TEST(Command, SequenceID) {
+
+  auto command = Command::make_nullary("build_room");
+
+  EXPECT_EQ(command->has_sequence_id(), false);
+  EXPECT_EQ(std::string(command->get_data()), "build_room\n");
+
+  command->set_sequence_id(7);
+
+  EXPECT_EQ(command->has_sequence_id(), true);
+  EXPECT_EQ(command->get_sequence_id(), 7);
+  EXPECT_EQ(std::string(command->get_data()), "seq 7\nbuild_room\n");
+
+  command->set_sequence_id(12);
+
+  EXPECT_EQ(command->get_sequence_id(), 12);
+  EXPECT_EQ(std::string(command->get_data()), "seq 12\nbuild_room\n");
+  EXPECT_EQ(command->get_size(), 18);
+}
+
+TEST(Command, Name) {
+
+  auto text_command = Command::make_nullary("build_room");
+
+  text_command->set_sequence_id(3);
+
+  EXPECT_EQ(std::string(text_command->get_name()), "build_room");
+
+  auto binary_command = Command::make_axis_update(0, 0.5, -0.5, Encoding::Binary);
+
+  EXPECT_EQ(std::string(binary_command->get_name()), "update_axis");
+
+  EXPECT_EQ(std::string(Command::make_null()->get_name()), "");
+}
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Binary.h>
+#include <herald/protocol/Lexer.h>
+#include <herald/protocol/ParseTree.h>
+#include <herald/protocol/Parser.h>
+#include <herald/protocol/Token.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace herald;
+using namespace herald::protocol;
+
+namespace {
+
+/// Generates the value of a matrix cell.
+/// This mixes small and negative values,
+/// like a room with empty tiles would have.
+int cell_value(std::size_t index) noexcept {
+  return (int) (index % 37) - 1;
+}
+
+/// Formats a square-ish matrix with a
+/// certain number of cells as a text response.
+std::string make_text_matrix(std::size_t w, std::size_t h) {
+
+  std::string text = std::to_string(w) + " " + std::to_string(h);
+
+  for (std::size_t i = 0; i < (w * h); i++) {
+    text += ' ';
+    text += std::to_string(cell_value(i));
+  }
+
+  text += '\n';
+
+  return text;
+}
+
+/// Appends a little-endian 32-bit value to a frame.
+void append_u32(std::vector<char>& frame, std::uint32_t value) {
+  frame.push_back((char) (value & 0xff));
+  frame.push_back((char) ((value >> 8) & 0xff));
+  frame.push_back((char) ((value >> 16) & 0xff));
+  frame.push_back((char) ((value >> 24) & 0xff));
+}
+
+/// Encodes a matrix as a binary response frame.
+std::vector<char> make_binary_matrix(std::size_t w, std::size_t h) {
+
+  std::vector<char> frame;
+
+  append_u32(frame, (std::uint32_t) (4 + 8 + (w * h * 4)));
+  append_u32(frame, untagged_sequence_id);
+  append_u32(frame, (std::uint32_t) w);
+  append_u32(frame, (std::uint32_t) h);
+
+  for (std::size_t i = 0; i < (w * h); i++) {
+    append_u32(frame, (std::uint32_t) cell_value(i));
+  }
+
+  return frame;
+}
+
+/// Decodes a text matrix the way the room builder does.
+void BM_TextMatrix(benchmark::State& state) {
+
+  auto w = (std::size_t) state.range(0);
+  auto h = (std::size_t) state.range(1);
+
+  auto text = make_text_matrix(w, h);
+
+  for (auto _ : state) {
+
+    auto lexer = StreamLexer::make();
+
+    lexer->write(text.data(), text.size());
+
+    lexer->next_line();
+
+    auto parser = Parser::make(lexer->get_tokens(), lexer->get_token_count());
+
+    auto matrix = parser->parse_matrix();
+
+    benchmark::DoNotOptimize(matrix->get_values());
+  }
+
+  state.SetBytesProcessed((int64_t) (state.iterations() * text.size()));
+  state.SetItemsProcessed((int64_t) (state.iterations() * w * h));
+}
+
+/// Decodes a binary matrix frame.
+void BM_BinaryMatrix(benchmark::State& state) {
+
+  auto w = (std::size_t) state.range(0);
+  auto h = (std::size_t) state.range(1);
+
+  auto frame = make_binary_matrix(w, h);
+
+  std::vector<std::int32_t> cells(w * h);
+
+  for (auto _ : state) {
+
+    auto decoder = FrameDecoder::make();
+
+    decoder->write(frame.data(), frame.size());
+
+    decoder->next_frame();
+
+    BinaryReader reader(decoder->get_payload(), decoder->get_payload_size());
+
+    std::uint32_t frame_w = 0;
+    std::uint32_t frame_h = 0;
+
+    reader.read_u32(frame_w);
+    reader.read_u32(frame_h);
+    reader.read_i32_array(cells.data(), ((std::size_t) frame_w) * frame_h);
+
+    benchmark::DoNotOptimize(cells.data());
+  }
+
+  state.SetBytesProcessed((int64_t) (state.iterations() * frame.size()));
+  state.SetItemsProcessed((int64_t) (state.iterations() * w * h));
+}
+
+} // namespace
+
+BENCHMARK(BM_TextMatrix)->Args({ 40, 25 })->Args({ 1000, 1000 });
+BENCHMARK(BM_BinaryMatrix)->Args({ 40, 25 })->Args({ 1000, 1000 });
@@ -0,0 +1,72 @@
+#include <herald/protocol/InputBatch.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <vector>
+
+namespace herald {
+
+namespace protocol {
+
+namespace {
+
+/// The implementation of the input batch interface.
+class InputBatchImpl final : public InputBatch {
+  /// The last axis value of each controller.
+  std::vector<AxisState> axes;
+  /// The button edges, in order.
+  std::vector<ButtonEdge> button_edges;
+public:
+  /// Removes all updates.
+  void clear() noexcept override {
+    axes.clear();
+    button_edges.clear();
+  }
+  /// Indicates if there are no updates.
+  bool empty() const noexcept override {
+    return axes.empty() && button_edges.empty();
+  }
+  /// Merges an axis update.
+  void update_axis(std::size_t controller, double x, double y) override {
+
+    for (auto& axis : axes) {
+      if (axis.controller == controller) {
+        axis.x = x;
+        axis.y = y;
+        return;
+      }
+    }
+
+    axes.push_back(AxisState { controller, x, y });
+  }
+  /// Adds a button update.
+  void update_button(std::size_t controller, std::size_t button, bool state) override {
+    button_edges.push_back(ButtonEdge { controller, button, state });
+  }
+  /// Accesses the axis values.
+  const AxisState* get_axes() const noexcept override {
+    return axes.data();
+  }
+  /// Accesses the number of axis values.
+  std::size_t get_axis_count() const noexcept override {
+    return axes.size();
+  }
+  /// Accesses the button edges.
+  const ButtonEdge* get_button_edges() const noexcept override {
+    return button_edges.data();
+  }
+  /// Accesses the number of button edges.
+  std::size_t get_button_edge_count() const noexcept override {
+    return button_edges.size();
+  }
+};
+
+} // namespace
+
+ScopedPtr<InputBatch> InputBatch::make() {
+  return new InputBatchImpl();
+}
+
+} // namespace protocol
+
+} // namespace herald
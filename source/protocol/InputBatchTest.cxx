@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Command.h>
+#include <herald/protocol/InputBatch.h>
+
+#include <string>
+
+using namespace herald;
+using namespace herald::protocol;
+
+TEST(InputBatch, Merge) {
+
+  auto batch = InputBatch::make();
+
+  EXPECT_EQ(batch->empty(), true);
+
+  batch->update_axis(0, 0.25, 0.5);
+  batch->update_button(0, 1, true);
+  batch->update_axis(1, 1, 1);
+  batch->update_axis(0, -1, 0);
+  batch->update_button(0, 1, false);
+
+  ASSERT_EQ(batch->get_axis_count(), 2);
+  EXPECT_EQ(batch->get_axes()[0].controller, 0);
+  EXPECT_EQ(batch->get_axes()[0].x, -1);
+  EXPECT_EQ(batch->get_axes()[0].y, 0);
+  EXPECT_EQ(batch->get_axes()[1].controller, 1);
+
+  ASSERT_EQ(batch->get_button_edge_count(), 2);
+  EXPECT_EQ(batch->get_button_edges()[0].state, true);
+  EXPECT_EQ(batch->get_button_edges()[1].state, false);
+
+  auto command = Command::make_batch_update(*batch);
+
+  std::string expected = "update_batch\n"
+                         "2\n"
+                         "0\n" + std::to_string(-1.0) + "\n" + std::to_string(0.0) + "\n"
+                         "1\n" + std::to_string(1.0) + "\n" + std::to_string(1.0) + "\n"
+                         "2\n"
+                         "0\n1\n1\n"
+                         "0\n1\n0\n";
+
+  EXPECT_EQ(std::string(command->get_data()), expected);
+
+  batch->clear();
+
+  EXPECT_EQ(batch->empty(), true);
+}
@@ -4,6 +4,11 @@
 
 #include <herald/protocol/Token.h>
 
+#include "Scan.h"
+
+#include <cstring>
+#include <vector>
+
 namespace herald {
 
 namespace protocol {
@@ -18,17 +23,24 @@ class LexerImpl final : public Lexer {
   std::size_t size;
   /// The position of the lexer among the data.
   std::size_t pos;
+  /// Used to find the end of character runs.
+  const Scanner* scanner;
 public:
   /// Constructs a new instance of the lexer implementation.
   /// @param d The data string to scan.
   /// @param s The number of characters in the data string.
-  constexpr LexerImpl(const char* d, std::size_t s) noexcept
-    : data(d), size(s), pos(0) {}
+  /// @param sc The scanner to find the end of character runs with.
+  LexerImpl(const char* d, std::size_t s, const Scanner& sc = get_scanner()) noexcept
+    : data(d), size(s), pos(0), scanner(&sc) {}
   /// Indicates whether or not the lexer
   /// has reached the end of its input.
   bool done() const noexcept override {
     return pos >= size;
   }
+  /// Accesses the position of the lexer among the data.
+  std::size_t position() const noexcept {
+    return pos;
+  }
   /// Scans for a token.
   /// @returns The token that was found.
   /// If the end of the input was reached,
@@ -71,22 +83,17 @@ protected:
   /// that begins the string literal.
   Token complete_string_literal(const char quote) noexcept;
   /// Completes a token and emits the signal.
-  Token complete(TokenType type, int size) noexcept;
+  Token complete(TokenType type, std::size_t size) noexcept;
   /// Indicates whether or not a character
   /// is a decimal digit.
   static bool is_digit(char c) noexcept {
     return ((c >= '0') && (c <= '9'));
   }
   /// Indicates whether or not a character
-  /// could be part of an identifier body.
-  static bool is_identifier(char c) noexcept {
-    return is_letter(c) || is_digit(c) || (c == '_');
-  }
-  /// Indicates whether or not a character
   /// is a letter.
   static bool is_letter(char c) noexcept {
     return ((c >= 'a') && (c <= 'z'))
-        || ((c >= 'A') && (c <= 'z'));
+        || ((c >= 'A') && (c <= 'Z'));
   }
 };
 
@@ -133,40 +140,34 @@ Token LexerImpl::complete_newline() noexcept {
 
 Token LexerImpl::complete_number() noexcept {
 
-  for (int i = 1; !out_of_bounds(i); i++) {
-    auto ch = peek(i);
-    if (!is_digit(ch)
-     && (ch != '.')
-     && (ch != '-')
-     && (ch != 'e')) {
-      return complete(TokenType::Number, i);
-    }
-  }
+  const auto* first = data + pos;
 
-  return complete(TokenType::Number, remaining());
-}
+  auto digit_count = 1 + scanner->scan_digits(first + 1, remaining() - 1);
 
-Token LexerImpl::complete_identifier() noexcept {
+  auto number_size = digit_count + scanner->scan_number(first + digit_count, remaining() - digit_count);
 
-  for (int i = 1; !out_of_bounds(i); i++) {
-    if (!is_identifier(peek(i))) {
-      return complete(TokenType::Identifier, i);
-    }
+  // A plain run of digits is converted right away,
+  // while it's still in the cache, so that the parser
+  // doesn't have to go over the digits a second time.
+  std::uint32_t value = 0;
+
+  if ((number_size == digit_count) && convert_digits(first, digit_count, value)) {
+    Token token(first, number_size, pos, value);
+    next(number_size);
+    return token;
   }
 
-  return complete(TokenType::Identifier, remaining());
+  return complete(TokenType::Number, number_size);
 }
 
-Token LexerImpl::complete_space() noexcept {
-
-  for (int i = 1; !out_of_bounds(i); i++) {
-    auto ch = peek(i);
-    if ((ch != ' ') && (ch != '\t')) {
-      return complete(TokenType::Space, i);
-    }
-  }
+Token LexerImpl::complete_identifier() noexcept {
+  auto body_size = scanner->scan_identifier(data + pos + 1, remaining() - 1);
+  return complete(TokenType::Identifier, 1 + body_size);
+}
 
-  return complete(TokenType::Space, remaining());
+Token LexerImpl::complete_space() noexcept {
+  auto space_size = scanner->scan_space(data + pos + 1, remaining() - 1);
+  return complete(TokenType::Space, 1 + space_size);
 }
 
 Token LexerImpl::complete_string_literal(char quote) noexcept {
@@ -179,7 +180,11 @@ Token LexerImpl::complete_string_literal(char quote) noexcept {
                   i - 1, i);
       next(i + 1);
       return token;
-    } else if (c == '\\') {
+    } else if ((c == '\r') || (c == '\n')) {
+      // String literals don't span lines, so that an
+      // unmatched quote only affects the line it's on.
+      return complete(TokenType::UnterminatedStringLiteral, i);
+    } else if ((c == '\\') && (peek(i + 1) != '\r') && (peek(i + 1) != '\n')) {
       i++;
     }
   }
@@ -187,18 +192,266 @@ Token LexerImpl::complete_string_literal(char quote) noexcept {
   return complete(TokenType::UnterminatedStringLiteral, remaining());
 }
 
-Token LexerImpl::complete(TokenType type, int size) noexcept {
+Token LexerImpl::complete(TokenType type, std::size_t size) noexcept {
   Token token(type, data + pos, size, pos);
   next(size);
   return token;
 }
 
+/// A token found by the stream lexer.
+/// Since the stream buffer may move while
+/// it grows, the token data is kept as an
+/// offset until the line is complete.
+struct StreamToken final {
+  /// The type of the token.
+  TokenType type;
+  /// The offset of the token data within the stream buffer.
+  std::size_t offset;
+  /// The number of characters in the token.
+  std::size_t size;
+  /// The value of a number, if the lexer converted it.
+  std::uint32_t value;
+  /// Whether or not the value was converted.
+  bool converted;
+  /// Constructs a new stream token.
+  /// @param t The token that was scanned.
+  /// @param o The offset of the token data within the stream buffer.
+  StreamToken(const Token& t, std::size_t o) noexcept
+    : type(t.get_type()), offset(o), size(t.get_size()), value(0), converted(false) {
+    converted = t.get_number_value(value);
+  }
+  /// Creates a token from the stream token.
+  /// @param base The start of the stream buffer.
+  /// @param line_offset The offset of the line the token is in.
+  Token to_token(const char* base, std::size_t line_offset) const noexcept {
+    if (converted) {
+      return Token(base + offset, size, offset - line_offset, value);
+    } else {
+      return Token(type, base + offset, size, offset - line_offset);
+    }
+  }
+};
+
+/// Marks the end of a complete line in the stream.
+struct LineMark final {
+  /// One passed the last token of the line.
+  std::size_t token_end;
+  /// One passed the last byte of the line.
+  std::size_t byte_end;
+  /// Constructs a new line mark.
+  constexpr LineMark(std::size_t t, std::size_t b) noexcept
+    : token_end(t), byte_end(b) {}
+};
+
+/// An implementation of the stream lexer interface.
+class StreamLexerImpl final : public StreamLexer {
+  /// The stream data that has not yet been discarded.
+  std::vector<char> buffer;
+  /// The number of bytes written to the buffer.
+  std::size_t used;
+  /// The position in the buffer that scanning resumes from.
+  /// This is always the start of a token.
+  std::size_t scan_pos;
+  /// The significant tokens scanned so far.
+  std::vector<StreamToken> scanned;
+  /// The complete lines found so far.
+  std::vector<LineMark> lines;
+  /// The index of the next line to go to.
+  std::size_t line_head;
+  /// The first token that belongs to the next line.
+  std::size_t token_head;
+  /// The first byte that belongs to the next line.
+  std::size_t byte_head;
+  /// The first token of the current line.
+  std::size_t line_token;
+  /// The first byte of the current line.
+  std::size_t line_byte;
+  /// The tokens of the current line.
+  std::vector<Token> tokens;
+public:
+  /// Constructs a new instance of the stream lexer.
+  StreamLexerImpl()
+    : used(0),
+      scan_pos(0),
+      line_head(0),
+      token_head(0),
+      byte_head(0),
+      line_token(0),
+      line_byte(0) {}
+  /// Reserves space at the end of the buffer.
+  char* reserve(std::size_t size) override {
+
+    if (buffer.size() < (used + size)) {
+      auto next_size = buffer.size() * 2;
+      buffer.resize((next_size < (used + size)) ? (used + size) : next_size);
+    }
+
+    return buffer.data() + used;
+  }
+  /// Scans the bytes written to the reserved space.
+  void commit(std::size_t size) override {
+    used += size;
+    scan();
+  }
+  /// Copies data into the stream.
+  void write(const char* data, std::size_t size) override {
+    std::memcpy(reserve(size), data, size);
+    commit(size);
+  }
+  /// Goes to the next complete line.
+  bool next_line() override;
+  /// Appends the next complete line to the current one.
+  bool append_line() override;
+  /// Accesses the tokens of the current line.
+  const Token* get_tokens() const noexcept override {
+    return tokens.data();
+  }
+  /// Accesses the number of tokens in the current line.
+  std::size_t get_token_count() const noexcept override {
+    return tokens.size();
+  }
+protected:
+  /// Scans the data that has not been scanned yet.
+  void scan();
+  /// Moves the unfinished line to the front of the buffer.
+  /// This is done once all complete lines have been consumed,
+  /// so that the buffer does not grow for the life of the stream.
+  void compact() noexcept;
+  /// Makes the tokens of the current line available.
+  /// Since the buffer may have moved since the line
+  /// was first found, the token data is resolved again.
+  void publish();
+  /// Indicates whether or not a token that ends
+  /// at the end of the available data may continue
+  /// once more data arrives.
+  static bool may_continue(const Token& token) noexcept {
+    switch (token.get_type()) {
+      case TokenType::Identifier:
+      case TokenType::Number:
+      case TokenType::Space:
+      case TokenType::UnterminatedStringLiteral:
+        return true;
+      case TokenType::Newline:
+        return token.has_data("\r");
+      case TokenType::Invalid:
+      case TokenType::NegativeSign:
+      case TokenType::StringLiteral:
+        break;
+    }
+    return false;
+  }
+};
+
+bool StreamLexerImpl::next_line() {
+
+  tokens.clear();
+
+  line_token = token_head;
+  line_byte = byte_head;
+
+  if (!append_line()) {
+    compact();
+    return false;
+  }
+
+  return true;
+}
+
+bool StreamLexerImpl::append_line() {
+
+  if (line_head >= lines.size()) {
+    return false;
+  }
+
+  const auto& mark = lines[line_head++];
+
+  token_head = mark.token_end;
+
+  byte_head = mark.byte_end;
+
+  publish();
+
+  return true;
+}
+
+void StreamLexerImpl::publish() {
+
+  tokens.clear();
+
+  for (auto i = line_token; i < token_head; i++) {
+    const auto& t = scanned[i];
+    tokens.push_back(t.to_token(buffer.data(), line_byte));
+  }
+}
+
+void StreamLexerImpl::scan() {
+
+  auto base = scan_pos;
+
+  LexerImpl lexer(buffer.data() + base, used - base);
+
+  while (!lexer.done()) {
+
+    auto token = lexer.scan();
+
+    if (lexer.done() && may_continue(token)) {
+      break;
+    }
+
+    scan_pos = base + lexer.position();
+
+    if (token.has_type(TokenType::Newline)) {
+      lines.emplace_back(scanned.size(), scan_pos);
+    } else if (!token.has_type(TokenType::Space)) {
+      auto offset = (std::size_t) (token.get_data() - buffer.data());
+      scanned.emplace_back(token, offset);
+    }
+  }
+}
+
+void StreamLexerImpl::compact() noexcept {
+
+  if (byte_head == 0) {
+    return;
+  }
+
+  std::memmove(buffer.data(), buffer.data() + byte_head, used - byte_head);
+
+  auto token_count = scanned.size() - token_head;
+
+  for (std::size_t i = 0; i < token_count; i++) {
+    scanned[i] = scanned[token_head + i];
+    scanned[i].offset -= byte_head;
+  }
+
+  scanned.erase(scanned.begin() + token_count, scanned.end());
+
+  lines.clear();
+
+  used -= byte_head;
+  scan_pos -= byte_head;
+
+  line_head = 0;
+  token_head = 0;
+  byte_head = 0;
+  line_token = 0;
+  line_byte = 0;
+}
+
 } // namespace
 
 ScopedPtr<Lexer> Lexer::make(const char* data, std::size_t size) {
   return new LexerImpl(data, size);
 }
 
+ScopedPtr<Lexer> make_lexer(const char* data, std::size_t size, const Scanner& scanner) {
+  return new LexerImpl(data, size, scanner);
+}
+
+ScopedPtr<StreamLexer> StreamLexer::make() {
+  return new StreamLexerImpl();
+}
+
 } // namespace protocol
 
 } // namespace herald
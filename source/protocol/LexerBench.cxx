@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Lexer.h>
+#include <herald/protocol/Token.h>
+
+#include "Scan.h"
+
+#include <string>
+
+using namespace herald;
+using namespace herald::protocol;
+
+namespace {
+
+/// Generates a room matrix response
+/// with a certain number of cells.
+std::string make_matrix_text(std::size_t cells) {
+
+  std::string text = std::to_string(cells) + " 1";
+
+  for (std::size_t i = 0; i < cells; i++) {
+    text += ' ';
+    text += std::to_string((i * 7919) % 1000);
+  }
+
+  text += '\n';
+
+  return text;
+}
+
+/// Scans a matrix response with one of the scanner backends.
+void BM_LexMatrix(benchmark::State& state) {
+
+  const auto* scanner = find_scanner((ScanBackend) state.range(0));
+  if (!scanner) {
+    state.SkipWithError("Backend not supported.");
+    return;
+  }
+
+  auto text = make_matrix_text((std::size_t) state.range(1));
+
+  for (auto _ : state) {
+
+    auto lexer = make_lexer(text.data(), text.size(), *scanner);
+
+    std::size_t count = 0;
+
+    while (!lexer->done()) {
+      lexer->scan();
+      count++;
+    }
+
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetBytesProcessed((int64_t) (state.iterations() * text.size()));
+}
+
+/// Scans a line padded with long runs of spaces,
+/// which is where the vector backends do best.
+void BM_LexPadded(benchmark::State& state) {
+
+  const auto* scanner = find_scanner((ScanBackend) state.range(0));
+  if (!scanner) {
+    state.SkipWithError("Backend not supported.");
+    return;
+  }
+
+  std::string text;
+
+  for (int i = 0; i < 1000; i++) {
+    text += std::string(60, ' ');
+    text += "set_action 1234 5678";
+  }
+
+  for (auto _ : state) {
+
+    auto lexer = make_lexer(text.data(), text.size(), *scanner);
+
+    std::size_t count = 0;
+
+    while (!lexer->done()) {
+      lexer->scan();
+      count++;
+    }
+
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetBytesProcessed((int64_t) (state.iterations() * text.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_LexMatrix)
+  ->ArgNames({ "backend", "cells" })
+  ->ArgsProduct({ { (int) ScanBackend::Scalar, (int) ScanBackend::SSE2, (int) ScanBackend::AVX2 },
+                  { 1000, 1000000 } });
+
+BENCHMARK(BM_LexPadded)
+  ->ArgName("backend")
+  ->Arg((int) ScanBackend::Scalar)
+  ->Arg((int) ScanBackend::SSE2)
+  ->Arg((int) ScanBackend::AVX2);
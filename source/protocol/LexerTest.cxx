@@ -5,7 +5,10 @@
 #include <herald/protocol/Lexer.h>
 #include <herald/protocol/Token.h>
 
+#include "Scan.h"
+
 #include <cstring>
+#include <string>
 
 using namespace herald;
 using namespace herald::protocol;
@@ -66,3 +69,210 @@ TEST(LexerTest, Scan) {
   EXPECT_EQ(tok11.has_type(TokenType::Newline), true);
   EXPECT_EQ(tok11.has_data("\r"), true);
 }
+
+TEST(LexerTest, PunctuationIsNotALetter) {
+
+  // The characters between 'Z' and 'a' can't start an identifier,
+  // the same way they can't continue one.
+  for (auto c : std::string("[\\]^`")) {
+
+    std::string text = std::string(1, c) + "abc";
+
+    auto lexer = Lexer::make(text.data(), text.size());
+
+    auto tok1 = lexer->scan();
+    EXPECT_EQ(tok1.has_type(TokenType::Invalid), true);
+    EXPECT_EQ(tok1.get_size(), 1);
+
+    auto tok2 = lexer->scan();
+    EXPECT_EQ(tok2.has_type(TokenType::Identifier), true);
+    EXPECT_EQ(tok2.has_data("abc"), true);
+  }
+}
+
+TEST(StreamLexerTest, SplitTokens) {
+
+  auto lexer = StreamLexer::make();
+
+  lexer->write("set_ac", 6);
+
+  EXPECT_EQ(lexer->next_line(), false);
+
+  lexer->write("tion 12", 7);
+  lexer->write("3 -4\r", 5);
+
+  EXPECT_EQ(lexer->next_line(), false);
+
+  lexer->write("\n5 6\n", 5);
+
+  ASSERT_EQ(lexer->next_line(), true);
+  ASSERT_EQ(lexer->get_token_count(), 4);
+
+  const auto* tokens = lexer->get_tokens();
+  EXPECT_EQ(tokens[0].has_type(TokenType::Identifier), true);
+  EXPECT_EQ(tokens[0].has_data("set_action"), true);
+  EXPECT_EQ(tokens[1].has_type(TokenType::Number), true);
+  EXPECT_EQ(tokens[1].has_data("123"), true);
+  EXPECT_EQ(tokens[2].has_type(TokenType::NegativeSign), true);
+  EXPECT_EQ(tokens[3].has_type(TokenType::Number), true);
+  EXPECT_EQ(tokens[3].has_data("4"), true);
+
+  ASSERT_EQ(lexer->next_line(), true);
+  ASSERT_EQ(lexer->get_token_count(), 2);
+  EXPECT_EQ(lexer->get_tokens()[0].has_data("5"), true);
+  EXPECT_EQ(lexer->get_tokens()[1].has_data("6"), true);
+
+  EXPECT_EQ(lexer->next_line(), false);
+}
+
+TEST(StreamLexerTest, ReserveAndCommit) {
+
+  auto lexer = StreamLexer::make();
+
+  for (int i = 0; i < 100; i++) {
+
+    const char line[] = "'a string' 42\n";
+
+    auto* data = lexer->reserve(sizeof(line) - 1);
+
+    std::memcpy(data, line, sizeof(line) - 1);
+
+    lexer->commit(sizeof(line) - 1);
+
+    ASSERT_EQ(lexer->next_line(), true);
+    ASSERT_EQ(lexer->get_token_count(), 2);
+    EXPECT_EQ(lexer->get_tokens()[0].has_type(TokenType::StringLiteral), true);
+    EXPECT_EQ(lexer->get_tokens()[0].has_data("a string"), true);
+    EXPECT_EQ(lexer->get_tokens()[1].has_data("42"), true);
+    EXPECT_EQ(lexer->next_line(), false);
+  }
+}
+
+TEST(StreamLexerTest, AppendLine) {
+
+  auto lexer = StreamLexer::make();
+
+  lexer->write("seq 1 2\n3 4\n", 12);
+
+  ASSERT_EQ(lexer->next_line(), true);
+  ASSERT_EQ(lexer->append_line(), true);
+  ASSERT_EQ(lexer->append_line(), false);
+
+  // Enough data to force the buffer to move.
+  std::string tail(4096, ' ');
+  tail += "5\n";
+
+  lexer->write(tail.data(), tail.size());
+
+  ASSERT_EQ(lexer->append_line(), true);
+  ASSERT_EQ(lexer->get_token_count(), 6);
+
+  const auto* tokens = lexer->get_tokens();
+  EXPECT_EQ(tokens[0].has_data("seq"), true);
+  EXPECT_EQ(tokens[3].has_data("3"), true);
+  EXPECT_EQ(tokens[4].has_data("4"), true);
+  EXPECT_EQ(tokens[5].has_data("5"), true);
+
+  EXPECT_EQ(lexer->next_line(), false);
+}
+
+TEST(StreamLexerTest, UnterminatedString) {
+
+  auto lexer = StreamLexer::make();
+
+  const char text[] = "set_action 'oops\\\n1 2\n3 4\n";
+
+  lexer->write(text, sizeof(text) - 1);
+
+  // The unmatched quote ends with its line,
+  // instead of holding back the lines after it.
+  ASSERT_EQ(lexer->next_line(), true);
+  ASSERT_EQ(lexer->get_token_count(), 2);
+  EXPECT_EQ(lexer->get_tokens()[1].has_type(TokenType::UnterminatedStringLiteral), true);
+  EXPECT_EQ(lexer->get_tokens()[1].has_data("'oops\\"), true);
+
+  ASSERT_EQ(lexer->next_line(), true);
+  ASSERT_EQ(lexer->get_token_count(), 2);
+  EXPECT_EQ(lexer->get_tokens()[0].has_data("1"), true);
+
+  ASSERT_EQ(lexer->next_line(), true);
+  ASSERT_EQ(lexer->get_token_count(), 2);
+  EXPECT_EQ(lexer->get_tokens()[1].has_data("4"), true);
+
+  EXPECT_EQ(lexer->next_line(), false);
+}
+
+TEST(Scanner, Backends) {
+
+  // Runs that end at every offset around the
+  // 16 and 32 byte boundaries of the vector backends.
+  for (std::size_t run = 0; run < 70; run++) {
+
+    std::string spaces(run, ' ');
+    spaces += " \t x";
+
+    std::string digits(run, '7');
+    digits += "e-1.5,";
+
+    std::string identifier(run, 'a');
+    identifier += "_Zz9~";
+
+    // The characters between 'Z' and 'a', other than '_',
+    // end an identifier. So does everything past 'z'.
+    const char terminators[] = "[\\]^`{";
+
+    const ScanBackend backends[] = {
+      ScanBackend::Scalar,
+      ScanBackend::SSE2,
+      ScanBackend::AVX2
+    };
+
+    for (auto backend : backends) {
+
+      const auto* scanner = find_scanner(backend);
+      if (!scanner) {
+        continue;
+      }
+
+      EXPECT_EQ(scanner->scan_space(spaces.data(), spaces.size()), run + 3);
+      EXPECT_EQ(scanner->scan_digits(digits.data(), digits.size()), run);
+      EXPECT_EQ(scanner->scan_number(digits.data(), digits.size()), run + 5);
+      EXPECT_EQ(scanner->scan_identifier(identifier.data(), identifier.size()), run + 4);
+
+      for (const char* c = terminators; *c; c++) {
+        auto text = std::string(run, 'a') + "_Zz9" + *c + "x";
+        EXPECT_EQ(scanner->scan_identifier(text.data(), text.size()), run + 4) << *c;
+      }
+    }
+  }
+}
+
+TEST(Lexer, ConvertNumbers) {
+
+  const char input[] = "7 123456789 1234567890 12.5";
+
+  auto lexer = Lexer::make(input, sizeof(input) - 1);
+
+  std::uint32_t value = 0;
+
+  auto a = lexer->scan();
+  lexer->scan();
+  auto b = lexer->scan();
+  lexer->scan();
+  auto c = lexer->scan();
+  lexer->scan();
+  auto d = lexer->scan();
+
+  EXPECT_EQ(a.get_number_value(value), true);
+  EXPECT_EQ(value, 7);
+
+  EXPECT_EQ(b.get_number_value(value), true);
+  EXPECT_EQ(value, 123456789);
+
+  // Too long to convert without checking for overflow.
+  EXPECT_EQ(c.get_number_value(value), false);
+  EXPECT_EQ(c.has_data("1234567890"), true);
+
+  EXPECT_EQ(d.get_number_value(value), false);
+  EXPECT_EQ(d.has_data("12.5"), true);
+}
@@ -1,10 +1,9 @@
 #include <herald/protocol/ParseTree.h>
 
-#include <herald/ScopedPtr.h>
-
+#include <herald/protocol/Arena.h>
 #include <herald/protocol/Token.h>
 
-#include <vector>
+#include "ArenaArray.h"
 
 namespace herald {
 
@@ -12,32 +11,66 @@ namespace protocol {
 
 namespace {
 
+/// A matrix cell that could not be decoded.
+struct MatrixError final {
+  /// The offset of the cell.
+  std::size_t offset;
+  /// The integer node of the cell.
+  Integer integer;
+};
+
 /// The full matrix implementation.
+/// Both the matrix and its arrays live in an arena.
 class MatrixImpl final : public Matrix {
-  /// The integers making up the matrix.
-  std::vector<Integer> values;
+  /// The values making up the matrix.
+  ArenaArray<std::int32_t> values;
+  /// The cells that could not be decoded.
+  ArenaArray<MatrixError> errors;
 public:
   /// Constructs a new instance of the matrix implementation.
-  MatrixImpl(const Size& s) noexcept : Matrix(s) {}
-  /// Adds an integer to the matrix.
+  /// @param s The size of the matrix.
+  /// @param arena The arena to allocate the arrays from.
+  MatrixImpl(const Size& s, Arena* arena) noexcept
+    : Matrix(s), values(arena), errors(arena) {}
+  /// Reserves space for the values.
+  void reserve(std::size_t count) override {
+    values.reserve(count);
+  }
+  /// Adds a value to the matrix.
   /// @param v The value to add.
-  void add(const Integer& v) override {
-    values.emplace_back(v);
+  void add(std::int32_t v) override {
+    values.push_back(v);
+  }
+  /// Adds a cell that could not be decoded.
+  /// @param i The integer node of the cell.
+  void add_error(const Integer& i) override {
+    errors.push_back(MatrixError { values.size(), i });
+    values.push_back(0);
+  }
+  /// Accesses the values of the matrix.
+  const std::int32_t* get_values() const noexcept override {
+    return values.get_data();
+  }
+  /// Accesses the number of values in the matrix.
+  std::size_t get_value_count() const noexcept override {
+    return values.size();
   }
-  /// Accesses an integer from the matrix.
-  /// @param index The index of the number to access.
-  /// @returns The specified integer value.
-  Integer get_integer(std::size_t index) const noexcept override {
-    if (index >= values.size()) {
+  /// Accesses the number of errors.
+  std::size_t get_error_count() const noexcept override {
+    return errors.size();
+  }
+  /// Accesses the cell offset of an error.
+  std::size_t get_error_offset(std::size_t index) const noexcept override {
+    return (index < errors.size()) ? errors[index].offset : 0;
+  }
+  /// Accesses the integer node of an error.
+  Integer get_error_integer(std::size_t index) const noexcept override {
+    if (index >= errors.size()) {
       return Integer(nullptr, nullptr);
     } else {
-      return values[index];
+      return errors[index].integer;
     }
   }
-  /// Accesses the number of integers in the matrix.
-  std::size_t get_integer_count() const noexcept override {
-    return values.size();
-  }
 };
 
 } // namespace
@@ -69,6 +102,13 @@ bool Integer::to_unsigned_value(unsigned int& n) const noexcept {
     return false;
   }
 
+  std::uint32_t converted = 0;
+
+  if (value->get_number_value(converted)) {
+    n = converted;
+    return true;
+  }
+
   n = 0;
 
   for (std::size_t i = 0; i < value->get_size(); i++) {
@@ -92,8 +132,8 @@ bool Size::to_values(int& w, int& h) const noexcept {
      && (w > 0) && (h > 0);
 }
 
-ScopedPtr<Matrix> Matrix::make(const Size& s) {
-  return new MatrixImpl(s);
+Matrix* Matrix::make(const Size& s, Arena& arena) {
+  return arena.make<MatrixImpl>(s, &arena);
 }
 
 } // namespace protocol
@@ -1,10 +1,13 @@
 #include <herald/protocol/Parser.h>
 
+#include <herald/protocol/Arena.h>
 #include <herald/protocol/ParseTree.h>
 #include <herald/protocol/Token.h>
 
 #include <herald/ScopedPtr.h>
 
+#include <utility>
+
 namespace herald {
 
 namespace protocol {
@@ -19,12 +22,24 @@ class ParserImpl final : public Parser {
   std::size_t count;
   /// The position of the parser within the token array.
   std::size_t pos;
+  /// The arena that nodes are allocated from.
+  Arena* arena;
+  /// The arena owned by the parser, if
+  /// it wasn't given one when created.
+  ScopedPtr<Arena> owned_arena;
 public:
   /// Constructs an instance of the parser implementation.
   /// @param t The tokens to be parsed.
   /// @param c The number of tokens in the token array.
-  constexpr ParserImpl(const Token* t, std::size_t c) noexcept
-    : tokens(t), count(c), pos(0) {}
+  /// @param a The arena to allocate nodes from.
+  ParserImpl(const Token* t, std::size_t c, Arena* a) noexcept
+    : tokens(t), count(c), pos(0), arena(a) {}
+  /// Constructs a parser that owns its arena.
+  /// @param t The tokens to be parsed.
+  /// @param c The number of tokens in the token array.
+  /// @param a The arena to take ownership of.
+  ParserImpl(const Token* t, std::size_t c, ScopedPtr<Arena>&& a) noexcept
+    : tokens(t), count(c), pos(0), arena(a.get()), owned_arena(std::move(a)) {}
   /// Indicates whether or not the parser
   /// has reached the end of the input.
   bool done() const noexcept override {
@@ -36,12 +51,14 @@ public:
   /// Parses for a size structure.
   Size parse_size() noexcept override;
   /// Parses for a matrix.
-  ScopedPtr<Matrix> parse_matrix() override;
+  Matrix* parse_matrix() override;
   /// Parses an arbitrary node.
-  ScopedPtr<Node> parse_any() override;
+  Node* parse_any() override;
 protected:
   /// Parses a "set_action" statement.
-  ScopedPtr<SetActionStmt> parse_set_action_stmt() override;
+  SetActionStmt* parse_set_action_stmt() override;
+  /// Parses a "set_camera" statement.
+  SetCameraStmt* parse_set_camera_stmt() override;
   /// Checks if the next token is a specific identifer.
   /// If it is, the parser will move passed it.
   /// @param id The identifier to check for.
@@ -130,11 +147,11 @@ Size ParserImpl::parse_size() noexcept {
   return Size(w, h);
 }
 
-ScopedPtr<Matrix> ParserImpl::parse_matrix() {
+Matrix* ParserImpl::parse_matrix() {
 
   auto size = parse_size();
 
-  auto matrix = Matrix::make(size);
+  auto* matrix = Matrix::make(size, *arena);
 
   if (!size.valid()) {
     return matrix;
@@ -147,29 +164,47 @@ ScopedPtr<Matrix> ParserImpl::parse_matrix() {
     return matrix;
   }
 
-  for (int i = 0; (i < (w * h)) && !done(); i++) {
+  auto cell_count = ((std::size_t) w) * ((std::size_t) h);
+
+  // The size comes from the game, so it can't be trusted
+  // to reserve with. Every cell takes at least one token,
+  // so the tokens that are left put a limit on the cells.
+  auto token_limit = done() ? 0 : (count - pos);
+
+  matrix->reserve((cell_count < token_limit) ? cell_count : token_limit);
+
+  for (std::size_t i = 0; (i < cell_count) && !done(); i++) {
+
     auto value = parse_integer();
-    if (!value.valid()) {
-      break;
+
+    int n = 0;
+
+    if (value.to_signed_value(n)) {
+      matrix->add((std::int32_t) n);
     } else {
-      matrix->add(value);
+      matrix->add_error(value);
     }
   }
 
   return matrix;
 }
 
-ScopedPtr<Node> ParserImpl::parse_any() {
+Node* ParserImpl::parse_any() {
 
-  auto set_action_stmt = parse_set_action_stmt();
+  auto* set_action_stmt = parse_set_action_stmt();
   if (set_action_stmt) {
     return set_action_stmt;
   }
 
+  auto* set_camera_stmt = parse_set_camera_stmt();
+  if (set_camera_stmt) {
+    return set_camera_stmt;
+  }
+
   return nullptr;
 }
 
-ScopedPtr<SetActionStmt> ParserImpl::parse_set_action_stmt() {
+SetActionStmt* ParserImpl::parse_set_action_stmt() {
 
   if (!match_identifier("set_action")) {
     return nullptr;
@@ -177,13 +212,29 @@ ScopedPtr<SetActionStmt> ParserImpl::parse_set_action_stmt() {
 
   auto object = parse_integer();
   auto action = parse_integer();
-  return new SetActionStmt(object, action);
+  return arena->make<SetActionStmt>(object, action);
+}
+
+SetCameraStmt* ParserImpl::parse_set_camera_stmt() {
+
+  if (!match_identifier("set_camera")) {
+    return nullptr;
+  }
+
+  auto x = parse_integer();
+  auto y = parse_integer();
+  auto tile_size = parse_integer();
+  return arena->make<SetCameraStmt>(x, y, tile_size);
 }
 
 } // namespace
 
 ScopedPtr<Parser> Parser::make(const Token* tokens, std::size_t count) {
-  return new ParserImpl(tokens, count);
+  return new ParserImpl(tokens, count, ScopedPtr<Arena>(new Arena));
+}
+
+Parser* Parser::make(const Token* tokens, std::size_t count, Arena& arena) {
+  return arena.make<ParserImpl>(tokens, count, &arena);
 }
 
 } // namespace protocol
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <herald/ScopedPtr.h>
+
+#include <herald/protocol/Arena.h>
+#include <herald/protocol/Lexer.h>
+#include <herald/protocol/ParseTree.h>
+#include <herald/protocol/Parser.h>
+#include <herald/protocol/SyntaxChecker.h>
+#include <herald/protocol/Token.h>
+
+#include <string>
+
+using namespace herald;
+using namespace herald::protocol;
+
+namespace {
+
+/// Generates a square room matrix response.
+/// @param side The width and height of the matrix.
+/// @param invalid_step If this isn't zero, then every cell
+/// at a multiple of this is an identifier instead of a number.
+std::string make_matrix_text(std::size_t side, std::size_t invalid_step) {
+
+  std::string text = std::to_string(side) + " " + std::to_string(side);
+
+  for (std::size_t i = 0; i < (side * side); i++) {
+    text += ' ';
+    if (invalid_step && ((i % invalid_step) == 0)) {
+      text += "x";
+    } else {
+      text += std::to_string((i * 7919) % 1000);
+    }
+  }
+
+  text += '\n';
+
+  return text;
+}
+
+/// Scans a matrix response into the stream lexer,
+/// the same way the hub does with the game's output.
+/// @returns The lexer, with the tokens of the matrix as its current line.
+ScopedPtr<StreamLexer> lex_matrix(std::size_t side, std::size_t invalid_step = 0) {
+
+  auto text = make_matrix_text(side, invalid_step);
+
+  auto lexer = StreamLexer::make();
+
+  lexer->write(text.data(), text.size());
+
+  lexer->next_line();
+
+  return lexer;
+}
+
+/// Parses a square matrix from tokens that were already scanned.
+void BM_ParseMatrix(benchmark::State& state) {
+
+  auto side = (std::size_t) state.range(0);
+
+  auto lexer = lex_matrix(side);
+
+  Arena arena;
+
+  for (auto _ : state) {
+
+    auto* parser = Parser::make(lexer->get_tokens(), lexer->get_token_count(), arena);
+
+    benchmark::DoNotOptimize(parser->parse_matrix());
+
+    arena.reset();
+  }
+
+  state.SetItemsProcessed((int64_t) (state.iterations() * side * side));
+}
+
+/// Runs the syntax checker over a parsed square matrix.
+/// The values are checked while parsing, so the checker
+/// only has work to do for the cells that were invalid.
+void BM_CheckMatrix(benchmark::State& state) {
+
+  auto side = (std::size_t) state.range(0);
+
+  auto lexer = lex_matrix(side, (std::size_t) state.range(1));
+
+  Arena tree_arena;
+
+  auto* matrix = Parser::make(lexer->get_tokens(), lexer->get_token_count(), tree_arena)->parse_matrix();
+
+  Arena arena;
+
+  for (auto _ : state) {
+
+    auto* errors = SyntaxErrorList::make(arena);
+
+    auto* checker = make_syntax_checker(errors, arena);
+
+    matrix->accept(*checker);
+
+    benchmark::DoNotOptimize(errors->size());
+
+    arena.reset();
+  }
+
+  state.SetItemsProcessed((int64_t) (state.iterations() * side * side));
+}
+
+} // namespace
+
+BENCHMARK(BM_ParseMatrix)->ArgName("side")->Arg(16)->Arg(128)->Arg(1024);
+
+BENCHMARK(BM_CheckMatrix)
+  ->ArgNames({ "side", "invalid_step" })
+  ->ArgsProduct({ { 128, 1024 }, { 0, 100 } });
@@ -85,26 +85,10 @@ TEST(Parser, ParseMatrix) {
   EXPECT_EQ(w, 2);
   EXPECT_EQ(h, 3);
 
-  EXPECT_EQ(matrix->get_integer_count(), 6);
-
-  auto a = matrix->get_integer(0);
-  auto b = matrix->get_integer(1);
-  auto c = matrix->get_integer(2);
-  auto d = matrix->get_integer(3);
-  auto e = matrix->get_integer(4);
-  auto f = matrix->get_integer(5);
-
-  int values[6] = {
-    0, 0, 0,
-    0, 0, 0
-  };
-
-  EXPECT_EQ(a.to_signed_value(values[0]), true);
-  EXPECT_EQ(b.to_signed_value(values[1]), true);
-  EXPECT_EQ(c.to_signed_value(values[2]), true);
-  EXPECT_EQ(d.to_signed_value(values[3]), true);
-  EXPECT_EQ(e.to_signed_value(values[4]), true);
-  EXPECT_EQ(f.to_signed_value(values[5]), true);
+  ASSERT_EQ(matrix->get_value_count(), 6);
+  EXPECT_EQ(matrix->get_error_count(), 0);
+
+  const auto* values = matrix->get_values();
 
   EXPECT_EQ(values[0], 111);
   EXPECT_EQ(values[1], 222);
@@ -114,6 +98,54 @@ TEST(Parser, ParseMatrix) {
   EXPECT_EQ(values[5], 666);
 }
 
+TEST(Parser, ParseMatrixErrors) {
+
+  std::vector<Token> tokens;
+  tokens.emplace_back(TokenType::Number, "3", 1, 0);
+  tokens.emplace_back(TokenType::Number, "1", 1, 0);
+  tokens.emplace_back(TokenType::NegativeSign, "-", 1, 0);
+  tokens.emplace_back(TokenType::Number, "1", 1, 0);
+  tokens.emplace_back(TokenType::Identifier, "x", 1, 0);
+  tokens.emplace_back(TokenType::Number, "7", 1, 0);
+
+  auto parser = Parser::make(tokens.data(), tokens.size());
+
+  auto matrix = parser->parse_matrix();
+
+  ASSERT_EQ(matrix->get_value_count(), 3);
+  ASSERT_EQ(matrix->get_error_count(), 1);
+  EXPECT_EQ(matrix->get_error_offset(0), 1);
+
+  const auto* values = matrix->get_values();
+
+  EXPECT_EQ(values[0], -1);
+  EXPECT_EQ(values[1], 0);
+  EXPECT_EQ(values[2], 7);
+}
+
+TEST(Parser, ParseMatrixOversized) {
+
+  // The size would take gigabytes to reserve,
+  // but only two values actually follow it.
+  std::vector<Token> tokens;
+  tokens.emplace_back(TokenType::Number, "60000", 5, 0);
+  tokens.emplace_back(TokenType::Number, "60000", 5, 0);
+  tokens.emplace_back(TokenType::Number, "1", 1, 0);
+  tokens.emplace_back(TokenType::Number, "2", 1, 0);
+
+  auto parser = Parser::make(tokens.data(), tokens.size());
+
+  auto matrix = parser->parse_matrix();
+
+  ASSERT_EQ(matrix->get_value_count(), 2);
+  EXPECT_EQ(matrix->get_error_count(), 0);
+
+  const auto* values = matrix->get_values();
+
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[1], 2);
+}
+
 TEST(Parser, ParseSetActionStmt) {
 
   std::vector<Token> tokens;
@@ -133,3 +165,30 @@ TEST(Parser, ParseSetActionStmt) {
   EXPECT_EQ(action_id.valid(), true);
   EXPECT_EQ(object_id.valid(), true);
 }
+
+TEST(Parser, ParseSetCameraStmt) {
+
+  std::vector<Token> tokens;
+  tokens.emplace_back(TokenType::Identifier, "set_camera", sizeof("set_camera") - 1, 0);
+  tokens.emplace_back(TokenType::Number, "12", 2, 0);
+  tokens.emplace_back(TokenType::NegativeSign, "-", 1, 0);
+  tokens.emplace_back(TokenType::Number, "3", 1, 0);
+  tokens.emplace_back(TokenType::Number, "32", 2, 0);
+
+  auto parser = Parser::make(tokens.data(), tokens.size());
+
+  auto set_camera_stmt = parser->parse_set_camera_stmt();
+
+  ASSERT_EQ(!!set_camera_stmt, true);
+
+  int x = 0;
+  int y = 0;
+  int tile_size = 0;
+
+  EXPECT_EQ(set_camera_stmt->get_x().to_signed_value(x), true);
+  EXPECT_EQ(set_camera_stmt->get_y().to_signed_value(y), true);
+  EXPECT_EQ(set_camera_stmt->get_tile_size().to_signed_value(tile_size), true);
+  EXPECT_EQ(x, 12);
+  EXPECT_EQ(y, -3);
+  EXPECT_EQ(tile_size, 32);
+}
@@ -0,0 +1,371 @@
+#include "Scan.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define HERALD_SCAN_X86 1
+#endif
+
+#ifdef HERALD_SCAN_X86
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define HERALD_TARGET_SSE2
+#define HERALD_TARGET_AVX2
+#else
+#define HERALD_TARGET_SSE2 __attribute__((target("sse2")))
+#define HERALD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#endif // HERALD_SCAN_X86
+
+namespace herald {
+
+namespace protocol {
+
+namespace {
+
+/// The most ranges that a range set may have.
+constexpr int max_ranges = 4;
+
+/// A set of up to four inclusive character ranges.
+/// Only ASCII ranges are supported, so that the signed
+/// byte comparisons of SSE2 and AVX2 can be used.
+struct RangeSet final {
+  /// The number of ranges in the set.
+  int count;
+  /// The first character of each range.
+  char lo[max_ranges];
+  /// The last character of each range.
+  char hi[max_ranges];
+  /// Indicates whether or not a character is in the set.
+  inline bool contains(char c) const noexcept {
+    for (int i = 0; i < count; i++) {
+      if ((c >= lo[i]) && (c <= hi[i])) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+constexpr RangeSet digit_set { 1, { '0', 0, 0, 0 }, { '9', 0, 0, 0 } };
+
+constexpr RangeSet number_set { 3, { '0', '-', 'e', 0 }, { '9', '.', 'e', 0 } };
+
+constexpr RangeSet space_set { 2, { ' ', '\t', 0, 0 }, { ' ', '\t', 0, 0 } };
+
+/// Digits, upper and lower case letters, and '_'. The letters are
+/// kept as separate ranges, since the characters between 'Z' and
+/// 'a' ("[\\]^_`") aren't part of an identifier, except for '_'.
+constexpr RangeSet identifier_set { 4, { '0', 'A', 'a', '_' }, { '9', 'Z', 'z', '_' } };
+
+/// Scans a run of characters one at a time.
+inline std::size_t scan_scalar(const char* data, std::size_t size, const RangeSet& set) noexcept {
+  std::size_t i = 0;
+  while ((i < size) && set.contains(data[i])) {
+    i++;
+  }
+  return i;
+}
+
+std::size_t scan_digits_scalar(const char* data, std::size_t size) noexcept {
+  return scan_scalar(data, size, digit_set);
+}
+
+std::size_t scan_number_scalar(const char* data, std::size_t size) noexcept {
+  return scan_scalar(data, size, number_set);
+}
+
+std::size_t scan_space_scalar(const char* data, std::size_t size) noexcept {
+  return scan_scalar(data, size, space_set);
+}
+
+std::size_t scan_identifier_scalar(const char* data, std::size_t size) noexcept {
+  return scan_scalar(data, size, identifier_set);
+}
+
+constexpr Scanner scalar_scanner {
+  ScanBackend::Scalar,
+  scan_digits_scalar,
+  scan_number_scalar,
+  scan_space_scalar,
+  scan_identifier_scalar
+};
+
+#ifdef HERALD_SCAN_X86
+
+/// Finds the index of the lowest set bit.
+/// @param mask The mask to search. This must not be zero.
+inline unsigned int lowest_bit(std::uint32_t mask) noexcept {
+#ifdef _MSC_VER
+  unsigned long index = 0;
+  _BitScanForward(&index, mask);
+  return (unsigned int) index;
+#else
+  return (unsigned int) __builtin_ctz(mask);
+#endif
+}
+
+/// The number of characters checked one at a time
+/// before the vector backends are used. Most tokens in
+/// a response are short, and for those it's faster to
+/// not set up the vector registers at all.
+constexpr std::size_t short_run = 8;
+
+/// Scans a run of characters sixteen at a time.
+HERALD_TARGET_SSE2
+std::size_t scan_sse2(const char* data, std::size_t size, const RangeSet& set) noexcept {
+
+  __m128i lo[max_ranges];
+  __m128i hi[max_ranges];
+
+  for (int r = 0; r < set.count; r++) {
+    lo[r] = _mm_set1_epi8((char) (set.lo[r] - 1));
+    hi[r] = _mm_set1_epi8((char) (set.hi[r] + 1));
+  }
+
+  std::size_t i = 0;
+
+  for (; (i + 16) <= size; i += 16) {
+
+    auto chunk = _mm_loadu_si128((const __m128i*) (data + i));
+
+    auto in_set = _mm_setzero_si128();
+
+    for (int r = 0; r < set.count; r++) {
+      auto in_range = _mm_and_si128(_mm_cmpgt_epi8(chunk, lo[r]),
+                                    _mm_cmplt_epi8(chunk, hi[r]));
+      in_set = _mm_or_si128(in_set, in_range);
+    }
+
+    auto outside = ~((std::uint32_t) _mm_movemask_epi8(in_set)) & 0xffffu;
+    if (outside) {
+      return i + lowest_bit(outside);
+    }
+  }
+
+  return i + scan_scalar(data + i, size - i, set);
+}
+
+/// Scans a run of characters thirty-two at a time.
+HERALD_TARGET_AVX2
+std::size_t scan_avx2(const char* data, std::size_t size, const RangeSet& set) noexcept {
+
+  __m256i lo[max_ranges];
+  __m256i hi[max_ranges];
+
+  for (int r = 0; r < set.count; r++) {
+    lo[r] = _mm256_set1_epi8((char) (set.lo[r] - 1));
+    hi[r] = _mm256_set1_epi8((char) (set.hi[r] + 1));
+  }
+
+  std::size_t i = 0;
+
+  for (; (i + 32) <= size; i += 32) {
+
+    auto chunk = _mm256_loadu_si256((const __m256i*) (data + i));
+
+    auto in_set = _mm256_setzero_si256();
+
+    for (int r = 0; r < set.count; r++) {
+      auto in_range = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, lo[r]),
+                                       _mm256_cmpgt_epi8(hi[r], chunk));
+      in_set = _mm256_or_si256(in_set, in_range);
+    }
+
+    auto outside = ~((std::uint32_t) _mm256_movemask_epi8(in_set));
+    if (outside) {
+      return i + lowest_bit(outside);
+    }
+  }
+
+  return i + scan_sse2(data + i, size - i, set);
+}
+
+/// Scans a run of characters, checking the first few
+/// characters one at a time before using a vector backend.
+/// @tparam vector_scan The vector backend to use.
+template <std::size_t (*vector_scan)(const char*, std::size_t, const RangeSet&) noexcept>
+inline std::size_t scan_hybrid(const char* data, std::size_t size, const RangeSet& set) noexcept {
+
+  auto limit = (size < short_run) ? size : short_run;
+
+  for (std::size_t i = 0; i < limit; i++) {
+    if (!set.contains(data[i])) {
+      return i;
+    }
+  }
+
+  return limit + vector_scan(data + limit, size - limit, set);
+}
+
+std::size_t scan_digits_sse2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_sse2>(data, size, digit_set);
+}
+
+std::size_t scan_number_sse2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_sse2>(data, size, number_set);
+}
+
+std::size_t scan_space_sse2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_sse2>(data, size, space_set);
+}
+
+std::size_t scan_identifier_sse2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_sse2>(data, size, identifier_set);
+}
+
+std::size_t scan_digits_avx2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_avx2>(data, size, digit_set);
+}
+
+std::size_t scan_number_avx2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_avx2>(data, size, number_set);
+}
+
+std::size_t scan_space_avx2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_avx2>(data, size, space_set);
+}
+
+std::size_t scan_identifier_avx2(const char* data, std::size_t size) noexcept {
+  return scan_hybrid<scan_avx2>(data, size, identifier_set);
+}
+
+constexpr Scanner sse2_scanner {
+  ScanBackend::SSE2,
+  scan_digits_sse2,
+  scan_number_sse2,
+  scan_space_sse2,
+  scan_identifier_sse2
+};
+
+constexpr Scanner avx2_scanner {
+  ScanBackend::AVX2,
+  scan_digits_avx2,
+  scan_number_avx2,
+  scan_space_avx2,
+  scan_identifier_avx2
+};
+
+/// Indicates whether or not the processor
+/// and operating system support SSE2.
+bool has_sse2() noexcept {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 1);
+  return (info[3] & (1 << 26)) != 0;
+#else
+  return __builtin_cpu_supports("sse2");
+#endif
+}
+
+/// Indicates whether or not the processor
+/// and operating system support AVX2.
+bool has_avx2() noexcept {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  // Both OSXSAVE and AVX are required
+  // before the register state can be checked.
+  if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+    return false;
+  }
+  if ((_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // HERALD_SCAN_X86
+
+/// Detects the fastest scanner.
+const Scanner& detect_scanner() noexcept {
+#ifdef HERALD_SCAN_X86
+  if (has_avx2()) {
+    return avx2_scanner;
+  } else if (has_sse2()) {
+    return sse2_scanner;
+  }
+#endif
+  return scalar_scanner;
+}
+
+} // namespace
+
+const Scanner& get_scanner() noexcept {
+  static const Scanner& scanner = detect_scanner();
+  return scanner;
+}
+
+const Scanner* find_scanner(ScanBackend backend) noexcept {
+  switch (backend) {
+    case ScanBackend::Scalar:
+      return &scalar_scanner;
+    case ScanBackend::SSE2:
+#ifdef HERALD_SCAN_X86
+      return has_sse2() ? &sse2_scanner : nullptr;
+#else
+      return nullptr;
+#endif
+    case ScanBackend::AVX2:
+#ifdef HERALD_SCAN_X86
+      return has_avx2() ? &avx2_scanner : nullptr;
+#else
+      return nullptr;
+#endif
+  }
+  return nullptr;
+}
+
+bool convert_digits(const char* data, std::size_t size, std::uint32_t& value) noexcept {
+
+  if ((size == 0) || (size > 9)) {
+    return false;
+  }
+
+  std::uint32_t n = 0;
+
+  std::size_t i = 0;
+
+#ifdef HERALD_SCAN_X86
+  // Converts eight digits at once.
+  // This relies on x86 being little-endian.
+  if (size >= 8) {
+
+    std::uint64_t chunk = 0;
+    std::memcpy(&chunk, data, 8);
+
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000ff000000ffull) * (100 + (1000000ull << 32)))
+          + (((chunk >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32)))) >> 32;
+
+    n = (std::uint32_t) chunk;
+
+    i = 8;
+  }
+#endif
+
+  for (; i < size; i++) {
+    n = (n * 10) + (std::uint32_t) (data[i] - '0');
+  }
+
+  value = n;
+
+  return true;
+}
+
+} // namespace protocol
+
+} // namespace herald
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+namespace protocol {
+
+class Lexer;
+
+/// Enumerates the implementations of the scanning functions.
+enum class ScanBackend : int {
+  /// One byte at a time. Always available.
+  Scalar,
+  /// Sixteen bytes at a time, using SSE2.
+  SSE2,
+  /// Thirty-two bytes at a time, using AVX2.
+  AVX2
+};
+
+/// A set of functions used by the lexer to find
+/// the end of a run of characters of a certain class.
+/// Each function returns the number of characters at
+/// the start of the data that belong to the class.
+struct Scanner final {
+  /// The implementation of the functions.
+  ScanBackend backend;
+  /// Scans decimal digits.
+  std::size_t (*scan_digits)(const char* data, std::size_t size) noexcept;
+  /// Scans the characters of a number token.
+  /// These are the digits, '.', '-' and 'e'.
+  std::size_t (*scan_number)(const char* data, std::size_t size) noexcept;
+  /// Scans spaces and tabs.
+  std::size_t (*scan_space)(const char* data, std::size_t size) noexcept;
+  /// Scans the characters of an identifier body.
+  std::size_t (*scan_identifier)(const char* data, std::size_t size) noexcept;
+};
+
+/// Gets the fastest scanner supported by the processor.
+/// This is detected the first time the function is called.
+const Scanner& get_scanner() noexcept;
+
+/// Finds a scanner with a specific implementation.
+/// @param backend The implementation to find.
+/// @returns A pointer to the scanner, or null if the
+/// implementation isn't supported by the processor
+/// or wasn't built in.
+const Scanner* find_scanner(ScanBackend backend) noexcept;
+
+/// Converts a run of decimal digits to an integer.
+/// @param data The digits to convert.
+/// @param size The number of digits. Only runs of
+/// one to nine digits are converted, since those
+/// can't overflow a 32-bit value.
+/// @param value Receives the converted value.
+/// @returns True on success, false if the run is too long or empty.
+bool convert_digits(const char* data, std::size_t size, std::uint32_t& value) noexcept;
+
+/// Creates a lexer that uses a specific scanner.
+/// @param data The data for the lexer to scan.
+/// @param size The number of characters in the data string.
+/// @param scanner The scanner for the lexer to use.
+/// @returns A new lexer instance.
+ScopedPtr<Lexer> make_lexer(const char* data, std::size_t size, const Scanner& scanner);
+
+} // namespace protocol
+
+} // namespace herald
@@ -1,11 +1,17 @@
 #include <herald/protocol/SyntaxChecker.h>
 
+#include <herald/protocol/Arena.h>
 #include <herald/protocol/ParseTree.h>
 #include <herald/protocol/Token.h>
 
 #include <herald/ScopedPtr.h>
 
-#include <sstream>
+#include "ArenaArray.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
 #include <vector>
 
 namespace herald {
@@ -22,14 +28,49 @@ public:
   /// Constructs an instance of the syntax error.
   /// @param id The ID of the syntax error.
   /// @param d A description of the error that occurred.
-  SyntaxErrorImpl(SyntaxErrorID id, std::string&& d)
-    : SyntaxError(id), description(std::move(d)) {}
+  SyntaxErrorImpl(SyntaxErrorID id, const char* d)
+    : SyntaxError(id), description(d) {}
   /// Accesses a decsription of the syntax error.
   const char* get_description() const noexcept override {
     return description.c_str();
   }
 };
 
+/// A syntax error that lives in an arena.
+class ArenaSyntaxError final : public SyntaxError {
+  /// A description of the syntax error.
+  /// This string is also allocated from the arena.
+  const char* description;
+public:
+  /// Constructs an instance of the syntax error.
+  /// @param id The ID of the syntax error.
+  /// @param d A description of the error that occurred.
+  constexpr ArenaSyntaxError(SyntaxErrorID id, const char* d) noexcept
+    : SyntaxError(id), description(d) {}
+  /// Accesses a decsription of the syntax error.
+  const char* get_description() const noexcept override {
+    return description;
+  }
+};
+
+/// The text of a token, as it appears in an error message.
+struct TokenText final {
+  /// The characters of the token.
+  const char* data;
+  /// The number of characters in the token.
+  int size;
+  /// Constructs the text of a token.
+  /// Newlines are escaped, so that
+  /// the message stays on one line.
+  TokenText(const Token& token) noexcept
+    : data(token.get_data()), size((int) token.get_size()) {
+    if (token.has_type(TokenType::Newline)) {
+      data = "\\n";
+      size = 2;
+    }
+  }
+};
+
 /// Used for verifying the correctness
 /// of a syntax node.
 class SyntaxChecker final : public Visitor {
@@ -45,24 +86,19 @@ public:
     const auto* sign = integer.get_sign_token();
 
     if (sign && !sign->has_type(TokenType::NegativeSign)) {
-      auto formatter = [sign](std::ostream& err) {
-        err << "Integer sign symbol " << *sign << " invalid.";
-      };
-      format_error(SyntaxErrorID::InvalidSignSymbol, formatter);
+      TokenText text(*sign);
+      format_error(SyntaxErrorID::InvalidSignSymbol,
+                   "Integer sign symbol '%.*s' invalid.", text.size, text.data);
     }
 
     const auto* value = integer.get_value_token();
 
     if (!value) {
-      auto formatter = [](std::ostream& err) {
-        err << "Missing integer value.";
-      };
-      format_error(SyntaxErrorID::MissingIntegerValue, formatter);
+      format_error(SyntaxErrorID::MissingIntegerValue, "Missing integer value.");
     } else if (!value->has_type(TokenType::Number)) {
-      auto formatter = [value](std::ostream& err) {
-        err << "Invalid integer value " << *value << ".";
-      };
-      format_error(SyntaxErrorID::InvalidIntegerValue, formatter);
+      TokenText text(*value);
+      format_error(SyntaxErrorID::InvalidIntegerValue,
+                   "Invalid integer value '%.*s'.", text.size, text.data);
     }
   }
   /// Checks the "set action" statement.
@@ -70,6 +106,21 @@ public:
     // TODO
     (void)stmt;
   }
+  /// Checks the "set camera" statement.
+  void visit(const SetCameraStmt& stmt) override {
+    visit(stmt.get_x());
+    visit(stmt.get_y());
+    visit(stmt.get_tile_size());
+    check_size_integer("tile size", stmt.get_tile_size());
+
+    int tile_size = 0;
+
+    if (stmt.get_tile_size().to_signed_value(tile_size) && (tile_size > max_tile_size)) {
+      format_error(SyntaxErrorID::InvalidTileSize,
+                   "Tile size %d is larger than the limit of %d.",
+                   tile_size, max_tile_size);
+    }
+  }
   /// Checks a size instance.
   void visit(const Size& size) override {
     check_size_integer("width", size.get_width());
@@ -88,42 +139,65 @@ public:
     size.get_width().to_signed_value(w);
     size.get_height().to_signed_value(h);
 
-    if ((w >= 0) && (h >= 0) && ((std::size_t)(w * h) != matrix.get_integer_count())) {
+    // The product is taken in std::size_t, since
+    // the size of a bad matrix may overflow an int.
+    auto cell_count = ((std::size_t) w) * ((std::size_t) h);
 
-      auto formatter = [w, h, &matrix](std::ostream& err) {
-        err << "Expected " << w << "x" << h;
-        err << " matrix to have " << w * h << " values,";
-        err << " but only " << matrix.get_integer_count() << " were found.";
-      };
-
-      format_error(SyntaxErrorID::MissingMatrixIntegers, formatter);
+    if ((w >= 0) && (h >= 0) && (cell_count != matrix.get_value_count())) {
+      format_error(SyntaxErrorID::MissingMatrixIntegers,
+                   "Expected %dx%d matrix to have %zu values, but only %zu were found.",
+                   w, h, cell_count, matrix.get_value_count());
     }
 
-    auto count = matrix.get_integer_count();
-    for (decltype(count) i = 0; i < count; i++) {
-      visit(matrix.get_integer(i));
+    auto error_count = matrix.get_error_count();
+    for (decltype(error_count) i = 0; i < error_count; i++) {
+      check_matrix_value(matrix.get_error_offset(i), matrix.get_error_integer(i));
     }
   }
 protected:
+  /// Reports a matrix cell that could not be decoded.
+  /// @param offset The offset of the cell within the matrix.
+  /// @param integer The integer node of the cell.
+  void check_matrix_value(std::size_t offset, const Integer& integer) {
+
+    const auto* value = integer.get_value_token();
+
+    if (value) {
+      TokenText text(*value);
+      format_error(SyntaxErrorID::InvalidMatrixValue,
+                   "Invalid matrix value '%.*s' at cell %zu.", text.size, text.data, offset);
+    } else {
+      format_error(SyntaxErrorID::InvalidMatrixValue,
+                   "Invalid matrix value at cell %zu.", offset);
+    }
+  }
   /// Checks an integer used to specify a size.
   /// @param name The name of the size field.
   /// @param integer The integer containing the size value.
   void check_size_integer(const char* name, const Integer& integer) {
     if (integer.is_negative()) {
-      auto formatter = [name](std::ostream& err) {
-        err << "Size '" << name << "' specifier must not be negative.";
-      };
-      format_error(SyntaxErrorID::InvalidSizeValue, formatter);
+      format_error(SyntaxErrorID::InvalidSizeValue,
+                   "Size '%s' specifier must not be negative.", name);
     }
   }
   /// Formats an error message and adds it to the error list.
-  /// @tparam Formatter The formatting function type.
-  /// @param formatter A functor used to format the error message.
-  template <typename Formatter>
-  void format_error(SyntaxErrorID id, Formatter formatter) {
-    std::ostringstream stream;
-    formatter(stream);
-    errors->add(new SyntaxErrorImpl(id, stream.str()));
+  /// The message is formatted into a stack buffer, so that
+  /// the only allocation is the one made by the error list.
+  /// @param id The ID of the error.
+  /// @param format The printf-style format of the message.
+#if defined(__GNUC__)
+  __attribute__((format(printf, 3, 4)))
+#endif
+  void format_error(SyntaxErrorID id, const char* format, ...) {
+
+    char message[256];
+
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    errors->add(id, message);
   }
 };
 
@@ -133,8 +207,8 @@ class SyntaxErrorListImpl final : public SyntaxErrorList {
   std::vector<ScopedPtr<SyntaxError>> errors;
 public:
   /// Adds an error to the list.
-  void add(SyntaxError* error) override {
-    errors.emplace_back(error);
+  void add(SyntaxErrorID id, const char* description) override {
+    errors.emplace_back(new SyntaxErrorImpl(id, description));
   }
   /// Accesses an error at a specific index.
   const SyntaxError* at(std::size_t index) const noexcept override {
@@ -146,16 +220,56 @@ public:
   }
 };
 
+/// A syntax error list that lives in an arena,
+/// along with the errors that are added to it.
+class ArenaSyntaxErrorList final : public SyntaxErrorList {
+  /// The arena to allocate the errors from.
+  Arena* arena;
+  /// The syntax errors added to the list.
+  ArenaArray<const SyntaxError*> errors;
+public:
+  /// Constructs the error list.
+  /// @param a The arena to allocate from.
+  ArenaSyntaxErrorList(Arena* a) noexcept : arena(a), errors(a) {}
+  /// Adds an error to the list.
+  void add(SyntaxErrorID id, const char* description) override {
+
+    auto size = std::strlen(description) + 1;
+
+    auto* copy = arena->make_array<char>(size);
+
+    std::memcpy(copy, description, size);
+
+    errors.push_back(arena->make<ArenaSyntaxError>(id, copy));
+  }
+  /// Accesses an error at a specific index.
+  const SyntaxError* at(std::size_t index) const noexcept override {
+    return (index < errors.size()) ? errors[index] : nullptr;
+  }
+  /// Indicates the size of the list.
+  std::size_t size() const noexcept override {
+    return errors.size();
+  }
+};
+
 } // namespace
 
 ScopedPtr<SyntaxErrorList> SyntaxErrorList::make() {
   return new SyntaxErrorListImpl;
 }
 
+SyntaxErrorList* SyntaxErrorList::make(Arena& arena) {
+  return arena.make<ArenaSyntaxErrorList>(&arena);
+}
+
 ScopedPtr<Visitor> make_syntax_checker(SyntaxErrorList* errors) {
   return new SyntaxChecker(errors);
 }
 
+Visitor* make_syntax_checker(SyntaxErrorList* errors, Arena& arena) {
+  return arena.make<SyntaxChecker>(errors);
+}
+
 } // namespace protocol
 
 } // namespace herald
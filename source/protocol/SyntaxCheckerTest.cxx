@@ -92,3 +92,33 @@ TEST(SyntaxChecker, GoodInteger2) {
 
   EXPECT_EQ(syntax_errors->size(), 0);
 }
+
+TEST(SyntaxChecker, InvalidTileSize) {
+
+  auto syntax_errors = SyntaxErrorList::make();
+
+  auto syntax_checker = make_syntax_checker(syntax_errors.get());
+
+  Token x_token(TokenType::Number, "0", 1, 0);
+  Token y_token(TokenType::Number, "0", 1, 0);
+  Token good_token(TokenType::Number, "1024", 4, 0);
+  Token bad_token(TokenType::Number, "100000", 6, 0);
+
+  SetCameraStmt good_stmt(Integer(nullptr, &x_token),
+                          Integer(nullptr, &y_token),
+                          Integer(nullptr, &good_token));
+
+  good_stmt.accept(*syntax_checker);
+
+  EXPECT_EQ(syntax_errors->size(), 0);
+
+  SetCameraStmt bad_stmt(Integer(nullptr, &x_token),
+                         Integer(nullptr, &y_token),
+                         Integer(nullptr, &bad_token));
+
+  bad_stmt.accept(*syntax_checker);
+
+  ASSERT_EQ(syntax_errors->size(), 1);
+
+  EXPECT_EQ(syntax_errors->at(0)->get_id(), SyntaxErrorID::InvalidTileSize);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace herald {
+
+namespace protocol {
+
+/// A bump allocator for the data of a single response.
+/// Memory is taken from large blocks and is only given
+/// back all at once, when the arena is reset. The blocks
+/// are kept across resets, so once the arena has grown to
+/// the size of a typical response, interpreting responses
+/// doesn't allocate from the heap anymore.
+///
+/// Destructors of objects made in the arena are never
+/// called, so only objects that don't own any other
+/// resources may be put into it.
+class Arena final {
+  /// A block of memory that allocations are taken from.
+  struct Block;
+  /// The first block of the arena.
+  Block* first;
+  /// The block that allocations are currently taken from.
+  Block* current;
+  /// The size of the next block to be allocated.
+  std::size_t next_block_size;
+public:
+  /// Constructs a new arena.
+  /// @param initial_block_size The size of the first block.
+  /// This block isn't allocated until it's first needed.
+  explicit Arena(std::size_t initial_block_size = 4096) noexcept;
+  /// Releases all the blocks of the arena.
+  ~Arena();
+  /// Arenas can't be copied.
+  Arena(const Arena&) = delete;
+  /// Arenas can't be copied.
+  Arena& operator = (const Arena&) = delete;
+  /// Allocates memory from the arena.
+  /// @param size The number of bytes to allocate.
+  /// @param alignment The alignment of the memory.
+  /// This must be a power of two.
+  /// @returns A pointer to the allocated memory.
+  void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+  /// Constructs an object in the arena.
+  /// @tparam T The type of object to construct.
+  /// @param args The arguments to pass to the constructor.
+  /// @returns A pointer to the new object.
+  template <typename T, typename... Args>
+  T* make(Args&&... args) {
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+  /// Allocates an uninitialized array from the arena.
+  /// @tparam T The type of the array elements.
+  /// This should be a trivial type.
+  /// @param count The number of elements in the array.
+  /// @returns A pointer to the first element of the array.
+  template <typename T>
+  T* make_array(std::size_t count) {
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+  }
+  /// Releases all allocations at once.
+  /// The blocks are kept for the next allocations.
+  void reset() noexcept;
+  /// Indicates the number of bytes in the blocks of the arena.
+  std::size_t get_capacity() const noexcept;
+};
+
+} // namespace protocol
+
+} // namespace herald
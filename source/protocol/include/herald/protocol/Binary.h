@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+namespace protocol {
+
+/// Enumerates the commands of the binary protocol.
+/// Each value is sent in place of the command name.
+enum class Opcode : std::uint32_t {
+  /// An unknown command.
+  None,
+  /// The "exit" command.
+  Exit,
+  /// The "set_background" command.
+  SetBackground,
+  /// The "build_room" command.
+  BuildRoom,
+  /// The "build_object_map" command.
+  BuildObjectMap,
+  /// The "update_axis" command.
+  UpdateAxis,
+  /// The "update_button" command.
+  UpdateButton,
+  /// The "update_batch" command.
+  UpdateBatch
+};
+
+/// Enumerates the statements that may appear
+/// in the binary response to an input update.
+enum class StmtOpcode : std::uint32_t {
+  /// Assigns an action to an object.
+  /// Followed by the object ID and action ID as int32 values.
+  SetAction,
+  /// Moves the camera. Followed by the X and Y coordinates
+  /// and the tile size of the camera as int32 values.
+  SetCamera
+};
+
+/// Finds the binary opcode of a command.
+/// @param name The name of the command, as used by the text protocol.
+/// @returns The opcode of the command. If the name is not
+/// known, then @ref Opcode::None is returned instead.
+Opcode find_opcode(const char* name) noexcept;
+
+/// The sequence ID of a binary frame that isn't tagged.
+constexpr std::uint32_t untagged_sequence_id = 0xffffffff;
+
+/// The number of bytes in the header of a frame.
+/// This includes the length prefix and the sequence ID.
+constexpr std::size_t frame_header_size = 8;
+
+/// The largest length prefix that a frame may have.
+/// Anything larger is treated as a framing error, rather
+/// than buffering the stream until that much data arrives.
+constexpr std::size_t max_frame_size = std::size_t(1) << 26;
+
+/// Used for reading fixed-width little-endian
+/// values from the payload of a binary frame.
+class BinaryReader final {
+  /// The payload data.
+  const unsigned char* data;
+  /// The number of bytes in the payload.
+  std::size_t size;
+  /// The read position within the payload.
+  std::size_t pos;
+public:
+  /// Constructs a new binary reader.
+  /// @param d The payload data to read.
+  /// @param s The number of bytes in the payload.
+  constexpr BinaryReader(const unsigned char* d, std::size_t s) noexcept
+    : data(d), size(s), pos(0) {}
+  /// Indicates whether or not all bytes were read.
+  inline bool done() const noexcept {
+    return pos >= size;
+  }
+  /// Indicates the number of bytes left to read.
+  inline std::size_t remaining() const noexcept {
+    return (pos < size) ? (size - pos) : 0;
+  }
+  /// Reads an unsigned 32-bit integer.
+  /// @param value Receives the value that was read.
+  /// @returns True on success, false if there
+  /// weren't enough bytes left to read.
+  bool read_u32(std::uint32_t& value) noexcept;
+  /// Reads a signed 32-bit integer.
+  /// @param value Receives the value that was read.
+  /// @returns True on success, false if there
+  /// weren't enough bytes left to read.
+  bool read_i32(std::int32_t& value) noexcept;
+  /// Reads a 32-bit float.
+  /// @param value Receives the value that was read.
+  /// @returns True on success, false if there
+  /// weren't enough bytes left to read.
+  bool read_f32(float& value) noexcept;
+  /// Reads an array of signed 32-bit integers.
+  /// @param values The array to put the values into.
+  /// @param count The number of values to read.
+  /// @returns True on success, false if there
+  /// weren't enough bytes left to read.
+  bool read_i32_array(std::int32_t* values, std::size_t count) noexcept;
+};
+
+/// Used for splitting a stream of binary
+/// responses into frames as the data arrives.
+/// Each frame starts with a 32-bit length prefix,
+/// which counts the bytes after it, followed by
+/// a 32-bit sequence ID and then the payload.
+class FrameDecoder {
+public:
+  /// Creates a new frame decoder instance.
+  /// @returns A new frame decoder instance.
+  static ScopedPtr<FrameDecoder> make();
+  /// Just a stub.
+  virtual ~FrameDecoder() {}
+  /// Reserves space at the end of the stream buffer.
+  /// Once the data is written, @ref commit must be called.
+  /// @param size The number of bytes to reserve.
+  /// @returns A pointer to the reserved space.
+  virtual char* reserve(std::size_t size) = 0;
+  /// Adds the data written into the reserved space.
+  /// @param size The number of bytes that were written.
+  virtual void commit(std::size_t size) = 0;
+  /// Copies data into the stream.
+  /// @param data The data to add to the stream.
+  /// @param size The number of bytes in @p data.
+  virtual void write(const char* data, std::size_t size) = 0;
+  /// Goes to the next complete frame in the stream.
+  /// @returns True if a complete frame is available,
+  /// false if more data is needed first or if the
+  /// stream has a framing error.
+  virtual bool next_frame() = 0;
+  /// Indicates whether the stream has a framing error.
+  /// This happens when a length prefix is too short to hold
+  /// the sequence ID or larger than @ref max_frame_size.
+  /// The start of the next frame can't be found after that,
+  /// so the decoder discards the stream and stops producing frames.
+  virtual bool has_error() const noexcept = 0;
+  /// Describes the framing error of the stream.
+  /// @returns A description of the error, or null if there isn't one.
+  virtual const char* get_error_description() const noexcept = 0;
+  /// Accesses the sequence ID of the current frame.
+  /// @returns The sequence ID of the frame, which is
+  /// @ref untagged_sequence_id if the frame isn't tagged.
+  virtual std::uint32_t get_sequence_id() const noexcept = 0;
+  /// Accesses the payload of the current frame.
+  /// This is only valid until the next call to
+  /// a non-const function of the decoder.
+  virtual const unsigned char* get_payload() const noexcept = 0;
+  /// Indicates the number of bytes in the payload of the current frame.
+  virtual std::size_t get_payload_size() const noexcept = 0;
+};
+
+} // namespace protocol
+
+} // namespace herald
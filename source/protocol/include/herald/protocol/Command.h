@@ -1,5 +1,7 @@
 #pragma once
 
+#include <herald/protocol/Encoding.h>
+
 #include <cstddef>
 
 namespace herald {
@@ -9,6 +11,8 @@ class ScopedPtr;
 
 namespace protocol {
 
+class InputBatch;
+
 /// The base of a command.
 class Command {
 public:
@@ -16,30 +20,63 @@ public:
   /// @param controller The index of the controller whose axis is updated.
   /// @param x The new X value.
   /// @param y The new Y value.
+  /// @param encoding The encoding of the command data.
   /// @returns A new command instance.
-  static ScopedPtr<Command> make_axis_update(std::size_t controller, double x, double y);
+  static ScopedPtr<Command> make_axis_update(std::size_t controller, double x, double y,
+                                             Encoding encoding = Encoding::Text);
   /// Creates a button state update command.
   /// @param controller The index of the controller whose button is updated.
   /// @param button The ID of the button that changed states.
   /// @param state The new state of the button.
+  /// @param encoding The encoding of the command data.
+  /// @returns A new command instance.
+  static ScopedPtr<Command> make_button_update(std::size_t controller, std::size_t button, bool state,
+                                               Encoding encoding = Encoding::Text);
+  /// Creates a command containing a batch of input updates.
+  /// @param batch The batch of input updates to send.
+  /// @param encoding The encoding of the command data.
   /// @returns A new command instance.
-  static ScopedPtr<Command> make_button_update(std::size_t controller, std::size_t button, bool state);
+  static ScopedPtr<Command> make_batch_update(const InputBatch& batch,
+                                              Encoding encoding = Encoding::Text);
   /// Creates a null command.
   /// This kind of command has no data
   /// and is mostly used as a placeholder.
   static ScopedPtr<Command> make_null();
   /// Creates a command with no operands.
-  /// @param data The command data to assign.
+  /// @param name The name of the command.
+  /// @param encoding The encoding of the command data.
   /// @returns A new command instance.
-  static ScopedPtr<Command> make_nullary(const char* data);
+  static ScopedPtr<Command> make_nullary(const char* name,
+                                        Encoding encoding = Encoding::Text);
   /// Just a stub.
   virtual ~Command() {}
+  /// Accesses the name of the command, such as "build_room".
+  /// This is the same in either encoding and isn't affected
+  /// by the sequence ID. A null command has an empty name.
+  virtual const char* get_name() const noexcept = 0;
   /// Accesses the command data.
   /// @returns A null-terminated string containing the command data.
+  /// In the binary encoding, the data may also contain null bytes,
+  /// so @ref get_size must be used to find the end of it.
   virtual const char* get_data() const noexcept = 0;
   /// Accesses the size of the command data.
   /// @returns The size, in terms of bytes, of the command data.
   virtual std::size_t get_size() const noexcept = 0;
+  /// Indicates whether or not the command
+  /// has been assigned a sequence ID.
+  virtual bool has_sequence_id() const noexcept = 0;
+  /// Accesses the sequence ID of the command.
+  /// @returns The sequence ID of the command.
+  /// This is only meaningful if @ref has_sequence_id
+  /// returns true.
+  virtual std::size_t get_sequence_id() const noexcept = 0;
+  /// Assigns a sequence ID to the command.
+  /// In the text encoding, the ID is written on a line
+  /// of its own ahead of the command data. In the binary
+  /// encoding, it is written to the frame header. Either
+  /// way, the game can tag the response to the command with it.
+  /// @param id The sequence ID to assign.
+  virtual void set_sequence_id(std::size_t id) = 0;
 };
 
 } // namespace protocol
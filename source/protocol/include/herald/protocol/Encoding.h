@@ -0,0 +1,19 @@
+#pragma once
+
+namespace herald {
+
+namespace protocol {
+
+/// Enumerates the ways that commands
+/// and responses may be encoded.
+enum class Encoding : int {
+  /// Line-oriented text. This is the default.
+  Text,
+  /// Length-prefixed frames with fixed-width,
+  /// little-endian integers and floats.
+  Binary
+};
+
+} // namespace protocol
+
+} // namespace herald
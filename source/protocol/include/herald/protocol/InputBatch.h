@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+
+namespace herald {
+
+template <typename T>
+class ScopedPtr;
+
+namespace protocol {
+
+/// The most recent axis value of a controller.
+struct AxisState final {
+  /// The index of the controller.
+  std::size_t controller;
+  /// The X value of the axis.
+  double x;
+  /// The Y value of the axis.
+  double y;
+};
+
+/// A change in the state of a controller button.
+struct ButtonEdge final {
+  /// The index of the controller.
+  std::size_t controller;
+  /// The ID of the button that changed states.
+  std::size_t button;
+  /// The new state of the button.
+  bool state;
+};
+
+/// Used for gathering the input updates
+/// that occur between two frames, so that
+/// they can be sent to the game as one command.
+/// Axis updates are merged, so that only the last
+/// value of each controller is kept. Button updates
+/// are all kept, in the order they occurred, so that
+/// a press and release within one frame isn't lost.
+/// The order between axis and button updates isn't
+/// kept, since the axis updates are sent first.
+class InputBatch {
+public:
+  /// Creates a new input batch instance.
+  /// @returns A new input batch instance.
+  static ScopedPtr<InputBatch> make();
+  /// Just a stub.
+  virtual ~InputBatch() {}
+  /// Removes all updates from the batch.
+  virtual void clear() noexcept = 0;
+  /// Indicates whether or not the batch has no updates.
+  virtual bool empty() const noexcept = 0;
+  /// Adds an axis update to the batch.
+  /// This replaces the previous axis update
+  /// of the controller, if there was one.
+  /// @param controller The index of the controller.
+  /// @param x The new X value.
+  /// @param y The new Y value.
+  virtual void update_axis(std::size_t controller, double x, double y) = 0;
+  /// Adds a button update to the batch.
+  /// @param controller The index of the controller.
+  /// @param button The ID of the button that changed states.
+  /// @param state The new state of the button.
+  virtual void update_button(std::size_t controller, std::size_t button, bool state) = 0;
+  /// Accesses the axis values, in the order that
+  /// the controllers were first updated.
+  virtual const AxisState* get_axes() const noexcept = 0;
+  /// Indicates the number of axis values in the batch.
+  virtual std::size_t get_axis_count() const noexcept = 0;
+  /// Accesses the button edges, in the order they occurred.
+  virtual const ButtonEdge* get_button_edges() const noexcept = 0;
+  /// Indicates the number of button edges in the batch.
+  virtual std::size_t get_button_edge_count() const noexcept = 0;
+};
+
+} // namespace protocol
+
+} // namespace herald
@@ -28,6 +28,58 @@ public:
   virtual Token scan() noexcept = 0;
 };
 
+/// Used for scanning tokens from a stream of
+/// response data that arrives in pieces, such
+/// as the standard output of a game process.
+/// The data is scanned as it arrives and the
+/// significant tokens (no spaces or newlines)
+/// are made available one line at a time.
+/// Tokens that are split across two writes
+/// are only emitted once they are complete.
+class StreamLexer {
+public:
+  /// Creates a new stream lexer instance.
+  /// @returns A new stream lexer instance.
+  static ScopedPtr<StreamLexer> make();
+  /// Just a stub.
+  virtual ~StreamLexer() {}
+  /// Reserves space at the end of the stream buffer,
+  /// so that data can be read into it without an
+  /// intermediate copy. Once the data is written,
+  /// @ref commit must be called.
+  /// @param size The number of bytes to reserve.
+  /// @returns A pointer to the reserved space.
+  virtual char* reserve(std::size_t size) = 0;
+  /// Scans the data written into the reserved space.
+  /// @param size The number of bytes that were written.
+  /// This must not be larger than the last reservation.
+  virtual void commit(std::size_t size) = 0;
+  /// Copies data into the stream and scans it.
+  /// @param data The data to add to the stream.
+  /// @param size The number of bytes in @p data.
+  virtual void write(const char* data, std::size_t size) = 0;
+  /// Goes to the next complete line in the stream.
+  /// The tokens of the previous line are discarded.
+  /// @returns True if a complete line is available,
+  /// false if more data is needed first.
+  virtual bool next_line() = 0;
+  /// Appends the tokens of the next complete line
+  /// to the tokens of the current line. This is used
+  /// for responses that span more than one line.
+  /// The tokens of the current line are kept, even
+  /// if more data has to be written before the next
+  /// line is complete.
+  /// @returns True if a complete line was appended,
+  /// false if more data is needed first.
+  virtual bool append_line() = 0;
+  /// Accesses the tokens of the current line.
+  /// These are only valid until the next call
+  /// to a non-const function of the lexer.
+  virtual const Token* get_tokens() const noexcept = 0;
+  /// Indicates the number of tokens in the current line.
+  virtual std::size_t get_token_count() const noexcept = 0;
+};
+
 } // namespace protocol
 
 } // namespace herald
@@ -1,18 +1,18 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace herald {
 
-template <typename T>
-class ScopedPtr;
-
 namespace protocol {
 
+class Arena;
 class Token;
 
 class Integer;
 class SetActionStmt;
+class SetCameraStmt;
 class Size;
 class Matrix;
 
@@ -28,6 +28,8 @@ public:
   virtual void visit(const Matrix&) = 0;
   /// Visits a "set action" statement.
   virtual void visit(const SetActionStmt&) = 0;
+  /// Visits a "set camera" statement.
+  virtual void visit(const SetCameraStmt&) = 0;
   /// Visits a size node.
   virtual void visit(const Size&) = 0;
 };
@@ -130,14 +132,22 @@ public:
 };
 
 /// Represents an integer matrix.
+/// The values are decoded while parsing and kept
+/// in one contiguous buffer, row by row. Cells that
+/// could not be decoded are given a value of zero
+/// and are recorded by their offset, so that the
+/// syntax checker can report them.
 class Matrix : public Node {
   /// The size of the matrix.
   Size size;
 public:
-  /// Creates a new matrix instance.
+  /// Creates a new matrix instance in an arena.
+  /// The values and errors of the matrix are also
+  /// allocated from the arena.
   /// @param s The size of the matrix.
-  /// @returns A new matrix instance.
-  static ScopedPtr<Matrix> make(const Size& s);
+  /// @param arena The arena to allocate the matrix from.
+  /// @returns A new matrix instance, which must not be deleted.
+  static Matrix* make(const Size& s, Arena& arena);
   /// Constructs the base matrix class.
   constexpr Matrix(const Size& s) noexcept : size(s) {}
   /// Just a stub.
@@ -146,20 +156,36 @@ public:
   void accept(Visitor& visitor) const override {
     visitor.visit(*this);
   }
-  /// Adds an integer to the matrix.
-  /// @param i The integer to add.
-  virtual void add(const Integer& i) = 0;
+  /// Reserves space for a number of values.
+  /// @param count The number of values to reserve space for.
+  virtual void reserve(std::size_t count) = 0;
+  /// Adds a value to the matrix.
+  /// @param value The value to add.
+  virtual void add(std::int32_t value) = 0;
+  /// Adds a cell that could not be decoded.
+  /// The cell is given a value of zero.
+  /// @param i The integer node of the cell.
+  virtual void add_error(const Integer& i) = 0;
   /// Accesses the size of the matrix.
   /// @returns The size specification of the matrix.
   inline Size get_size() const noexcept {
     return size;
   }
-  /// Accesses an integer from the matrix.
-  /// @param index The index of the integer to get.
-  /// @returns The integer at the specified index.
-  virtual Integer get_integer(std::size_t index) const noexcept = 0;
-  /// Accesses the number of integers in the marix.
-  virtual std::size_t get_integer_count() const noexcept = 0;
+  /// Accesses the values of the matrix, row by row.
+  /// @returns A pointer to the first value of the matrix.
+  virtual const std::int32_t* get_values() const noexcept = 0;
+  /// Accesses the number of values in the marix.
+  virtual std::size_t get_value_count() const noexcept = 0;
+  /// Accesses the number of cells that could not be decoded.
+  virtual std::size_t get_error_count() const noexcept = 0;
+  /// Accesses the offset of a cell that could not be decoded.
+  /// @param index The index of the error.
+  /// @returns The offset of the cell, from the first value.
+  virtual std::size_t get_error_offset(std::size_t index) const noexcept = 0;
+  /// Accesses the integer node of a cell that could not be decoded.
+  /// @param index The index of the error.
+  /// @returns The integer node of the cell.
+  virtual Integer get_error_integer(std::size_t index) const noexcept = 0;
 };
 
 /// A statement used to set the action
@@ -189,6 +215,45 @@ public:
   }
 };
 
+/// The largest tile size that the camera may be given, in pixels.
+/// Each texture is scaled to the tile size, so this keeps the
+/// scaled pixmaps and the size of the room on screen bounded.
+constexpr int max_tile_size = 1024;
+
+/// A statement used to move the camera
+/// that the room is viewed through.
+class SetCameraStmt final : public Node {
+  /// The X coordinate that the camera is centered on.
+  Integer x;
+  /// The Y coordinate that the camera is centered on.
+  Integer y;
+  /// The size of a tile on the screen, in pixels.
+  Integer tile_size;
+public:
+  /// Constructs a new "set camera" statement.
+  /// @param x_ The X coordinate to center the camera on, in tiles.
+  /// @param y_ The Y coordinate to center the camera on, in tiles.
+  /// @param t The size of a tile on the screen, in pixels.
+  constexpr SetCameraStmt(const Integer& x_, const Integer& y_, const Integer& t) noexcept
+    : x(x_), y(y_), tile_size(t) {}
+  /// Accepts a visitor.
+  void accept(Visitor& visitor) const override {
+    visitor.visit(*this);
+  }
+  /// Accesses the X coordinate of the camera.
+  Integer get_x() const noexcept {
+    return x;
+  }
+  /// Accesses the Y coordinate of the camera.
+  Integer get_y() const noexcept {
+    return y;
+  }
+  /// Accesses the size of a tile on the screen.
+  Integer get_tile_size() const noexcept {
+    return tile_size;
+  }
+};
+
 } // namespace protocol
 
 } // namespace herald
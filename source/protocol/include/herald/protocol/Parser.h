@@ -9,20 +9,36 @@ class ScopedPtr;
 
 namespace protocol {
 
+class Arena;
 class Integer;
 class Matrix;
 class Node;
 class SetActionStmt;
+class SetCameraStmt;
 class Size;
 class Token;
 
 /// Used for parsing responses from the game.
+/// The nodes returned by the parser are allocated
+/// from an arena and are owned by it, so they stay
+/// valid until the arena is either reset or destroyed.
 class Parser {
 public:
   /// Creates a new parser instance.
+  /// The parser owns the arena that the nodes are
+  /// allocated from, so the nodes are valid for as
+  /// long as the parser is.
   /// @param tokens The tokens to be parsed.
   /// @param count The number of tokens to parse.
   static ScopedPtr<Parser> make(const Token* tokens, std::size_t count);
+  /// Creates a new parser instance in an arena.
+  /// The parser and its nodes are allocated from the
+  /// arena and are released when the arena is reset.
+  /// @param tokens The tokens to be parsed.
+  /// @param count The number of tokens to parse.
+  /// @param arena The arena to allocate from.
+  /// @returns A pointer to the parser, which must not be deleted.
+  static Parser* make(const Token* tokens, std::size_t count, Arena& arena);
   /// Just a stub.
   virtual ~Parser() {}
   /// Indicates when the parser has reached the
@@ -30,7 +46,8 @@ public:
   virtual bool done() const noexcept = 0;
   /// Parses an arbitrary node.
   /// @returns A pointer to the node that was found.
-  virtual ScopedPtr<Node> parse_any() = 0;
+  /// If no node was found, a null pointer is returned.
+  virtual Node* parse_any() = 0;
   /// Parses an integer.
   /// @returns An integer node.
   /// Must be validated before using.
@@ -38,13 +55,19 @@ public:
   /// Parses a "set_action" statement.
   /// @returns On success, a pointer to a "set_action" statement.
   /// On failure, a null pointer.
-  virtual ScopedPtr<SetActionStmt> parse_set_action_stmt() = 0;
+  virtual SetActionStmt* parse_set_action_stmt() = 0;
+  /// Parses a "set_camera" statement.
+  /// @returns On success, a pointer to a "set_camera" statement.
+  /// On failure, a null pointer.
+  virtual SetCameraStmt* parse_set_camera_stmt() = 0;
   /// Parses for a size specifier.
   /// @returns A size node.
   /// Must be validated before using.
   virtual Size parse_size() noexcept = 0;
   /// Parses for a matrix.
-  virtual ScopedPtr<Matrix> parse_matrix() = 0;
+  /// @returns A pointer to the matrix.
+  /// Must be validated before using.
+  virtual Matrix* parse_matrix() = 0;
 };
 
 } // namespace protocol
@@ -9,6 +9,7 @@ class ScopedPtr;
 
 namespace protocol {
 
+class Arena;
 class Visitor;
 
 /// Enumerates the several possible
@@ -24,8 +25,12 @@ enum class SyntaxErrorID : int {
   InvalidSizeValue,
   /// The case of an integer missing a value token.
   MissingIntegerValue,
+  /// A matrix cell that could not be decoded.
+  InvalidMatrixValue,
   /// An integer with missing matrix values.
-  MissingMatrixIntegers
+  MissingMatrixIntegers,
+  /// A camera tile size above @ref max_tile_size.
+  InvalidTileSize
 };
 
 /// Represents an arbitrary syntax error.
@@ -52,10 +57,19 @@ public:
   /// Creates a new syntax error list.
   /// @returns A new syntax error list instance.
   static ScopedPtr<SyntaxErrorList> make();
+  /// Creates a new syntax error list in an arena.
+  /// The errors added to the list are also allocated
+  /// from the arena.
+  /// @param arena The arena to allocate from.
+  /// @returns A new syntax error list, which must not be deleted.
+  static SyntaxErrorList* make(Arena& arena);
   /// Just a stub.
   virtual ~SyntaxErrorList() {}
   /// Adds a syntax error to the list.
-  virtual void add(SyntaxError* error) = 0;
+  /// @param id The ID of the syntax error.
+  /// @param description A description of the error.
+  /// The list keeps a copy of this string.
+  virtual void add(SyntaxErrorID id, const char* description) = 0;
   /// Accesses a syntax error at a specific index.
   /// @param index The index of the error to get.
   /// @returns A pointer to the syntax error on success.
@@ -71,6 +85,12 @@ public:
 /// @returns A new instance of a syntax checker as a visitor interface.
 ScopedPtr<Visitor> make_syntax_checker(SyntaxErrorList* list);
 
+/// Creates a syntax checker in an arena.
+/// @param list A list to store syntax errors into.
+/// @param arena The arena to allocate the checker from.
+/// @returns A syntax checker, which must not be deleted.
+Visitor* make_syntax_checker(SyntaxErrorList* list, Arena& arena);
+
 } // namespace protocol
 
 } // namespace herald
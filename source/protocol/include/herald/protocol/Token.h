@@ -3,6 +3,7 @@
 #include <iosfwd>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace herald {
 
@@ -48,13 +49,20 @@ class Token final {
   /// original input data. This may be
   /// helpful in displaying an error message.
   std::size_t offset;
+  /// The value of a number token, if it
+  /// was converted while it was scanned.
+  std::uint32_t value;
+  /// Whether or not @ref value is set.
+  bool converted;
 public:
   /// Default constructor, makes an invalid token.
   constexpr Token() noexcept
     : type(TokenType::Invalid),
       data(""),
       size(0),
-      offset(0) {}
+      offset(0),
+      value(0),
+      converted(false) {}
   /// Constructs a new token instance.
   /// @param t The type of this token.
   /// @param d The character data of the token.
@@ -68,14 +76,39 @@ public:
     : type(t),
       data(d),
       size(s),
-      offset(o) {}
+      offset(o),
+      value(0),
+      converted(false) {}
+  /// Constructs a number token whose
+  /// value was converted by the lexer.
+  /// @param d The character data of the token.
+  /// @param s The number of characters in the token.
+  /// @param o The offset of the token along the
+  /// origin input data.
+  /// @param v The value of the number.
+  constexpr Token(const char* d,
+                  std::size_t s,
+                  std::size_t o,
+                  std::uint32_t v) noexcept
+    : type(TokenType::Number),
+      data(d),
+      size(s),
+      offset(o),
+      value(v),
+      converted(true) {}
   /// Constructs a token via copy.
   /// @param copy The token to copy.
   constexpr Token(const Token& other) noexcept
     : type(other.type),
       data(other.data),
       size(other.size),
-      offset(other.offset) {}
+      offset(other.offset),
+      value(other.value),
+      converted(other.converted) {}
+  /// Assigns a token via copy.
+  /// @param other The token to copy.
+  /// @returns A reference to this token.
+  Token& operator = (const Token& other) noexcept = default;
   /// Creates an invalid token instance.
   /// @returns An invalid token instance.
   static constexpr Token invalid() noexcept {
@@ -85,10 +118,29 @@ public:
   inline char at(std::size_t index) const noexcept {
     return (index < size) ? data[index] : 0;
   }
+  /// Accesses the character data of the token.
+  /// This is not null-terminated, see @ref get_size.
+  inline const char* get_data() const noexcept {
+    return data;
+  }
   /// Accesses the number of characters in the token.
   inline std::size_t get_size() const noexcept {
     return size;
   }
+  /// Accesses the value of a number token that
+  /// was converted while it was being scanned.
+  /// @param n Receives the value of the number.
+  /// @returns True if the value was converted by
+  /// the lexer, false if it has to be converted
+  /// from the character data instead.
+  inline bool get_number_value(std::uint32_t& n) const noexcept {
+    n = value;
+    return converted;
+  }
+  /// Accesses the type of the token.
+  inline TokenType get_type() const noexcept {
+    return type;
+  }
   /// Indicates if the token has a certain type.
   /// @param t The type to check for.
   /// @returns True if the types are equal, false otherwise.
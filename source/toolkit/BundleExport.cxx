@@ -0,0 +1,243 @@
+#include "BundleExport.h"
+
+#include <herald/BundleWriter.h>
+#include <herald/Index.h>
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QString>
+#include <QStringList>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace herald {
+
+namespace tk {
+
+namespace {
+
+/// Used for exporting a game directory into a bundle.
+/// Textures are visited in the same order as the
+/// game hub's directory loader, so that the texture
+/// and animation indices are the same either way.
+class BundleExporter final {
+  /// The game directory.
+  QDir root;
+  /// The bundle being built.
+  BundleWriter writer;
+  /// The index of each texture that was added,
+  /// keyed by the hash of the texture's file content.
+  std::map<QByteArray, std::size_t> texture_indices;
+  /// The pixels of the texture being converted.
+  std::vector<std::uint32_t> pixels;
+  /// A description of the last error.
+  QString error;
+public:
+  /// Constructs the bundle exporter.
+  /// @param game_path The path to the game directory.
+  BundleExporter(const QString& game_path) : root(game_path) {}
+  /// Accesses the description of the last error.
+  const QString& get_error() const noexcept {
+    return error;
+  }
+  /// Reads the game directory into the bundle.
+  /// @returns True on success, false on failure.
+  bool read() {
+
+    if (!root.exists()) {
+      error = "Game directory '" + root.path() + "' doesn't exist";
+      return false;
+    }
+
+    return read_textures()
+        && read_actions();
+  }
+  /// Writes the bundle file.
+  /// @param path The path to write the bundle to.
+  /// @returns True on success, false on failure.
+  bool write(const QString& path) {
+
+    auto data = writer.build();
+
+    QSaveFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly)
+     || (file.write((const char*) data.data(), (qint64) data.size()) != (qint64) data.size())
+     || !file.commit()) {
+      error = "Failed to write '" + path + "' (" + file.errorString() + ")";
+      return false;
+    }
+
+    return true;
+  }
+protected:
+  /// Reads the actions file.
+  /// @returns True on success, false on failure.
+  bool read_actions() {
+
+    QFile actions_file(root.filePath("actions.json"));
+
+    if (!actions_file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+      error = "Failed to open '" + actions_file.fileName() + "' (" + actions_file.errorString() + ")";
+      return false;
+    }
+
+    auto actions_doc = QJsonDocument::fromJson(actions_file.readAll());
+
+    for (auto action : actions_doc.array()) {
+
+      auto animation = action.toObject()["animation"].toInt(-1);
+
+      writer.add_action((animation < 0) ? Index() : Index((std::size_t) animation));
+    }
+
+    return true;
+  }
+  /// Reads the textures and animations.
+  /// @returns True on success, false on failure.
+  bool read_textures() {
+
+    QDir::Filters filters = QDir::NoDotAndDotDot | QDir::NoSymLinks | QDir::Files | QDir::Dirs;
+
+    for (auto texture : get_sorted_dir_entries(root.filePath("textures"), filters)) {
+
+      if (QFileInfo(texture).isDir()) {
+        if (!read_animation_dir(texture)) {
+          return false;
+        }
+      } else {
+
+        auto index = add_texture(texture);
+        if (index.invalid()) {
+          return false;
+        }
+
+        // A still frame, like the directory loader's.
+        writer.add_animation();
+        writer.add_frame(index, SIZE_MAX);
+      }
+    }
+
+    return true;
+  }
+  /// Reads a directory of textures that make up an animation.
+  /// @param path The path to the animation directory.
+  /// @returns True on success, false on failure.
+  bool read_animation_dir(const QString& path) {
+
+    // Default 30fps
+    std::size_t delay = 1000 / 30;
+
+    writer.add_animation();
+
+    for (auto texture : get_sorted_dir_entries(path, QDir::NoDotAndDotDot | QDir::NoSymLinks | QDir::Files)) {
+
+      auto index = add_texture(texture);
+      if (index.invalid()) {
+        return false;
+      }
+
+      writer.add_frame(index, delay);
+    }
+
+    return true;
+  }
+  /// Decodes a texture and adds it to the bundle, unless
+  /// a texture with the same file content was added already.
+  /// @param path The path to the texture.
+  /// @returns The index of the texture, or an invalid index on failure.
+  Index add_texture(const QString& path) {
+
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+      error = "Failed to open '" + path + "' (" + file.errorString() + ")";
+      return Index();
+    }
+
+    auto data = file.readAll();
+
+    auto key = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+
+    auto it = texture_indices.find(key);
+    if (it != texture_indices.end()) {
+      return Index(it->second);
+    }
+
+    auto image = QImage::fromData(data).convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    if (image.isNull()) {
+      error = "Failed to decode '" + path + "'";
+      return Index();
+    }
+
+    auto width = (std::size_t) image.width();
+    auto height = (std::size_t) image.height();
+
+    pixels.resize(width * height);
+
+    for (std::size_t y = 0; y < height; y++) {
+      const auto* line = (const std::uint32_t*) image.constScanLine((int) y);
+      std::copy(line, line + width, pixels.data() + (y * width));
+    }
+
+    auto index = writer.get_texture_count();
+
+    writer.add_texture(width, height, pixels.data());
+
+    texture_indices.emplace(key, index);
+
+    return Index(index);
+  }
+  /// Accumulates the paths of a directory
+  /// and sorts them into a string list.
+  /// @param path The path to get the entries of.
+  /// @param filters The filters to apply to the entries.
+  /// @returns A list of files and or directories from the specified path.
+  QStringList get_sorted_dir_entries(const QString& path, QDir::Filters filters) {
+
+    QDirIterator dir_iterator(path, filters);
+
+    QStringList entry_list;
+
+    while (dir_iterator.hasNext()) {
+      entry_list << dir_iterator.next();
+    }
+
+    entry_list.sort();
+
+    return entry_list;
+  }
+};
+
+} // namespace
+
+bool export_bundle(const QString& game_path, const QString& bundle_path, QString* error) {
+
+  BundleExporter exporter(game_path);
+
+  if (exporter.read() && exporter.write(bundle_path)) {
+    return true;
+  }
+
+  if (error) {
+    *error = exporter.get_error();
+  }
+
+  return false;
+}
+
+} // namespace tk
+
+} // namespace herald
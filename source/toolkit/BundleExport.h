@@ -0,0 +1,24 @@
+#pragma once
+
+class QString;
+
+namespace herald {
+
+namespace tk {
+
+/// Exports a game directory into a bundle, which the game hub
+/// maps instead of reading the directory. The textures are decoded
+/// and stored as premultiplied ARGB pixels, and textures with the
+/// same file content are only stored once.
+/// @param game_path The path to the game directory. This uses
+/// the same layout that the game hub reads: a "textures" directory,
+/// where subdirectories are animations, and an "actions.json" file.
+/// @param bundle_path The path to write the bundle to.
+/// @param error If this isn't null, then it's assigned a
+/// description of the error that occurred.
+/// @returns True on success, false on failure.
+bool export_bundle(const QString& game_path, const QString& bundle_path, QString* error = nullptr);
+
+} // namespace tk
+
+} // namespace herald
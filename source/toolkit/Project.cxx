@@ -2,6 +2,7 @@
 
 #include <herald/ScopedPtr.h>
 
+#include <QCryptographicHash>
 #include <QFile>
 #include <QFileInfo>
 #include <QJsonArray>
@@ -9,6 +10,8 @@
 #include <QJsonObject>
 #include <QSaveFile>
 
+#include <map>
+#include <utility>
 #include <vector>
 
 namespace herald {
@@ -47,6 +50,9 @@ struct Texture final {
   QString path;
   /// The image data of the texture.
   QByteArray data;
+  /// The hash of the image data, used
+  /// to find textures with the same data.
+  QByteArray hash;
   /// The modification flag.
   ModifyFlag* mod_flag;
   /// Constructs a new entry instance.
@@ -61,7 +67,17 @@ struct Texture final {
     auto obj = json_value.toObject();
     name = obj["name"].toString();
     path = obj["path"].toString();
-    data = QByteArray::fromBase64(obj["data"].toString().toUtf8());
+    set_data(QByteArray::fromBase64(obj["data"].toString().toUtf8()));
+  }
+  /// Indicates whether or not two textures have the same image data.
+  bool same_data(const Texture& other) const {
+    return (hash == other.hash) && (data == other.data);
+  }
+  /// Assigns the image data of the texture.
+  /// @param d The image data to assign.
+  void set_data(const QByteArray& d) {
+    data = d;
+    hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
   }
   /// Reloads the texture data.
   /// @returns True on success, false on failure.
@@ -73,12 +89,19 @@ struct Texture final {
     }
   }
   /// Converts the texture to a JSON value.
+  /// @param original The index of an earlier texture with the same
+  /// data. If this isn't negative, then the data isn't written again
+  /// and the earlier texture is referred to instead.
   /// @returns The JSON representation of the texture.
-  QJsonValue to_json() const {
+  QJsonValue to_json(int original = -1) const {
     QJsonObject object;
     object["name"] = name;
     object["path"] = path;
-    object["data"] = QString(data.toBase64());
+    if (original < 0) {
+      object["data"] = QString(data.toBase64());
+    } else {
+      object["duplicate_of"] = original;
+    }
     return object;
   }
 protected:
@@ -90,7 +113,7 @@ protected:
     if (!file.open(QIODevice::ReadOnly)) {
       return false;
     } else {
-      data = file.readAll();
+      set_data(file.readAll());
       return true;
     }
   }
@@ -107,19 +130,36 @@ public:
   /// @param mf The project modification flag.
   /// @param parent A pointer to the parent object.
   TextureTableImpl(ModifyFlag* mf, QObject* parent) : TextureTable(parent), mod_flag(mf) {}
-  /// Adds a texture to the table.
+  /// Adds a texture to the table. If a texture with the
+  /// same image data is in the table already, then that
+  /// texture is used instead of adding a new one.
   /// @param path The path of the texture to add.
   /// @returns The name assigned to the texture.
   QString add(const QString& path) override {
 
+    auto texture = ScopedPtr<Texture>::make(path, mod_flag);
+
+    auto original = find_same_data(*texture);
+    if (original < textures.size()) {
+      emit reused(original);
+      return textures[original]->name;
+    }
+
     mod_flag->set(true);
 
-    textures.emplace_back(ScopedPtr<Texture>::make(path, mod_flag));
+    textures.emplace_back(std::move(texture));
 
     emit added(textures.size() - 1);
 
     return textures[textures.size() - 1]->name;
   }
+  /// Finds a texture with the same data as a file.
+  /// @param path The path of the texture file.
+  /// @returns The index of the texture, or the table size if there isn't one.
+  std::size_t find_same_data(const QString& path) const override {
+    Texture texture(path, mod_flag);
+    return find_same_data(texture);
+  }
   /// Locates data associated with a texture.
   /// @param name The name of the texture to find the data of.
   /// @returns The data for the specified texture.
@@ -164,7 +204,14 @@ public:
     }
 
     for (auto texture : value.toArray()) {
+
       textures.emplace_back(ScopedPtr<Texture>::make(texture, mod_flag));
+
+      // Textures with the same data as an earlier one only refer to it.
+      auto original = texture.toObject()["duplicate_of"].toInt(-1);
+      if ((original >= 0) && (((std::size_t) original) < (textures.size() - 1))) {
+        textures.back()->set_data(textures[original]->data);
+      }
     }
 
     return true;
@@ -227,14 +274,46 @@ public:
 
     QJsonArray json_array;
 
-    for (const auto& texture : textures) {
-      json_array.append(texture->to_json());
+    // The first texture with each hash, so that
+    // duplicate image data is only saved once.
+    std::map<QByteArray, int> originals;
+
+    for (std::size_t i = 0; i < textures.size(); i++) {
+
+      const auto& texture = textures[i];
+
+      auto it = originals.find(texture->hash);
+
+      if ((it != originals.end()) && texture->same_data(*textures[it->second])) {
+        json_array.append(texture->to_json(it->second));
+      } else {
+        originals.emplace(texture->hash, (int) i);
+        json_array.append(texture->to_json());
+      }
     }
 
     return json_array;
   }
   /// Indicates the number of textures in the texture table.
   std::size_t size() const noexcept override {
+    return textures.size();
+  }
+protected:
+  /// Finds a texture in the table with the same data as another.
+  /// A texture that failed to read has no data, which would
+  /// match any other one that failed, so it's never matched.
+  /// @param texture The texture to find the data of.
+  /// @returns The index of the texture, or the table size if there isn't one.
+  std::size_t find_same_data(const Texture& texture) const {
+
+    if (!texture.data.isEmpty()) {
+      for (std::size_t i = 0; i < textures.size(); i++) {
+        if (textures[i]->same_data(texture)) {
+          return i;
+        }
+      }
+    }
+
     return textures.size();
   }
 };
@@ -24,10 +24,21 @@ public:
   /// Just a stub.
   virtual ~TextureTable() { }
   /// Makes a new entry for a texture
-  /// in the texture table.
+  /// in the texture table. If a texture with the same
+  /// image data is in the table already, then no entry
+  /// is made. Instead, @ref reused is emitted rather than
+  /// @ref added, and the name of that texture is returned.
+  /// Textures whose data couldn't be read always get an entry.
   /// @param path The path of the texture to add to the table.
   /// @returns The ID of the texture.
   virtual QString add(const QString& path) = 0;
+  /// Finds a texture with the same image data as a file.
+  /// This is the texture that @ref add would reuse, so it
+  /// can be checked before the table is changed.
+  /// @param path The path of the texture file.
+  /// @returns The index of the texture with the same data,
+  /// or @ref size if there isn't one or the file can't be read.
+  virtual std::size_t find_same_data(const QString& path) const = 0;
   /// Locates texture data by name.
   /// @param name The name of the texture to locate.
   /// @returns The data of the specified texture.
@@ -67,6 +78,10 @@ signals:
   void renamed(std::size_t index);
   /// This signal is emitted when a texture is added to the table.
   void added(std::size_t index);
+  /// This signal is emitted when a texture being added has the
+  /// same data as one in the table, so no entry was made for it.
+  /// @param index The index of the texture that has the same data.
+  void reused(std::size_t index);
   /// This signal is emitted when a texture is removed from the table.
   /// @param name The name of the texture that was removed.
   void removed(const QString& name);
@@ -31,13 +31,20 @@ public:
   /// @param path The path of the texture to add.
   void add_texture(const QString& path) {
 
-    auto table_size = project->access_texture_table()->size();
+    auto* table = project->modify_texture_table();
 
-    auto last_index = index(table_size, 0);
+    auto table_size = table->size();
 
-    beginInsertRows(last_index, table_size, table_size + 1);
+    // No row is made for a texture with the
+    // same data as one that's in the table.
+    if (table->find_same_data(path) < table_size) {
+      table->add(path);
+      return;
+    }
+
+    beginInsertRows(QModelIndex(), int(table_size), int(table_size));
 
-    project->modify_texture_table()->add(path);
+    table->add(path);
 
     endInsertRows();
   }
@@ -122,6 +129,9 @@ public:
 
     QObject::connect(table_editor.get(), &TableEditor::button_clicked, button_functor);
     QObject::connect(table_editor.get(), &TableEditor::selected, display_functor);
+
+    // Importing a texture that's already in the table shows that texture instead.
+    QObject::connect(project->access_texture_table(), &TextureTable::reused, display_functor);
   }
   /// Accesses a pointer to the root widget.
   QWidget* get_widget() noexcept override {
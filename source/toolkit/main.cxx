@@ -1,10 +1,14 @@
 #include <QApplication>
+#include <QStringList>
 
 #include <herald/ScopedPtr.h>
 
+#include "BundleExport.h"
 #include "Manager.h"
 #include "StartupDialog.h"
 
+#include <cstdlib>
+
 int main(int argc, char** argv) {
 
   QApplication app(argc, argv);
@@ -12,6 +16,20 @@ int main(int argc, char** argv) {
   QCoreApplication::setOrganizationName("Taylor Holberton");
   QCoreApplication::setApplicationName("Herald Toolkit");
 
+  auto args = app.arguments();
+
+  if ((args.size() == 4) && (args[1] == "--export-bundle")) {
+
+    QString error;
+
+    if (!herald::tk::export_bundle(args[2], args[3], &error)) {
+      qCritical("%s", qPrintable(error));
+      return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   Q_INIT_RESOURCE(icons);
 
   auto manager = herald::tk::Manager::make();